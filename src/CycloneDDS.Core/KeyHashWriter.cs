@@ -0,0 +1,167 @@
+using System;
+using System.Buffers;
+using System.Buffers.Binary;
+using System.Security.Cryptography;
+
+namespace CycloneDDS.Core
+{
+    /// <summary>
+    /// Writer for the XTypes 16-byte key hash.
+    /// Key members are serialized as big-endian XCDR2 (maximum alignment 4, strings with NUL).
+    /// If the maximum key size of the type exceeds 16 bytes the hash is the MD5 of that stream,
+    /// otherwise it is the stream itself, zero-padded to 16 bytes.
+    /// Method names mirror <see cref="CdrWriter"/> so generated key code can target both.
+    /// </summary>
+    public ref struct KeyHashWriter
+    {
+        public const int HashSize = 16;
+
+        private Span<byte> _span;
+        private byte[]? _rented;
+        private int _position;
+
+        public KeyHashWriter(Span<byte> scratch)
+        {
+            _span = scratch;
+            _rented = null;
+            _position = 0;
+        }
+
+        public int Position => _position;
+
+        // Key hash is always XCDR2
+        public bool IsXcdr2 => true;
+
+        public ReadOnlySpan<byte> WrittenSpan => _span.Slice(0, _position);
+
+        public void Align(int alignment)
+        {
+            if (alignment > 4) alignment = 4;
+            int aligned = AlignmentMath.Align(_position, alignment);
+            if (aligned > _position)
+            {
+                EnsureSize(aligned - _position);
+                _span.Slice(_position, aligned - _position).Clear();
+                _position = aligned;
+            }
+        }
+
+        public void WriteByte(byte value)
+        {
+            EnsureSize(1);
+            _span[_position++] = value;
+        }
+
+        public void WriteUInt8(byte value) => WriteByte(value);
+
+        public void WriteInt8(sbyte value) => WriteByte((byte)value);
+
+        public void WriteBool(bool value) => WriteByte(value ? (byte)1 : (byte)0);
+
+        public void WriteInt16(short value)
+        {
+            EnsureSize(sizeof(short));
+            BinaryPrimitives.WriteInt16BigEndian(_span.Slice(_position), value);
+            _position += sizeof(short);
+        }
+
+        public void WriteUInt16(ushort value)
+        {
+            EnsureSize(sizeof(ushort));
+            BinaryPrimitives.WriteUInt16BigEndian(_span.Slice(_position), value);
+            _position += sizeof(ushort);
+        }
+
+        public void WriteInt32(int value)
+        {
+            EnsureSize(sizeof(int));
+            BinaryPrimitives.WriteInt32BigEndian(_span.Slice(_position), value);
+            _position += sizeof(int);
+        }
+
+        public void WriteUInt32(uint value)
+        {
+            EnsureSize(sizeof(uint));
+            BinaryPrimitives.WriteUInt32BigEndian(_span.Slice(_position), value);
+            _position += sizeof(uint);
+        }
+
+        public void WriteInt64(long value)
+        {
+            EnsureSize(sizeof(long));
+            BinaryPrimitives.WriteInt64BigEndian(_span.Slice(_position), value);
+            _position += sizeof(long);
+        }
+
+        public void WriteUInt64(ulong value)
+        {
+            EnsureSize(sizeof(ulong));
+            BinaryPrimitives.WriteUInt64BigEndian(_span.Slice(_position), value);
+            _position += sizeof(ulong);
+        }
+
+        public void WriteFloat(float value)
+        {
+            EnsureSize(sizeof(float));
+            BinaryPrimitives.WriteSingleBigEndian(_span.Slice(_position), value);
+            _position += sizeof(float);
+        }
+
+        public void WriteDouble(double value)
+        {
+            EnsureSize(sizeof(double));
+            BinaryPrimitives.WriteDoubleBigEndian(_span.Slice(_position), value);
+            _position += sizeof(double);
+        }
+
+        public void WriteString(ReadOnlySpan<char> value, bool? isXcdr2 = null)
+        {
+            // Length includes the NUL terminator, as Cyclone does for key hashes
+            int utf8Length = System.Text.Encoding.UTF8.GetByteCount(value);
+            WriteInt32(utf8Length + 1);
+
+            EnsureSize(utf8Length + 1);
+            _position += System.Text.Encoding.UTF8.GetBytes(value, _span.Slice(_position));
+            _span[_position++] = 0;
+        }
+
+        /// <summary>
+        /// Writes the final hash and releases any rented buffer.
+        /// </summary>
+        /// <param name="hash16">Destination, at least 16 bytes.</param>
+        /// <param name="useMd5">True when the maximum key size of the type exceeds 16 bytes.</param>
+        public void Complete(Span<byte> hash16, bool useMd5)
+        {
+            if (hash16.Length < HashSize)
+                throw new ArgumentException("Key hash destination must be at least 16 bytes.", nameof(hash16));
+
+            if (useMd5)
+            {
+                MD5.HashData(WrittenSpan, hash16);
+            }
+            else
+            {
+                // Bounded keys of at most 16 bytes are used as-is
+                WrittenSpan.CopyTo(hash16);
+                hash16.Slice(_position, HashSize - _position).Clear();
+            }
+
+            if (_rented != null)
+            {
+                ArrayPool<byte>.Shared.Return(_rented);
+                _rented = null;
+            }
+        }
+
+        private void EnsureSize(int size)
+        {
+            if (_position + size <= _span.Length) return;
+
+            byte[] larger = ArrayPool<byte>.Shared.Rent(Math.Max(_span.Length * 2, _position + size));
+            _span.Slice(0, _position).CopyTo(larger);
+            if (_rented != null) ArrayPool<byte>.Shared.Return(_rented);
+            _rented = larger;
+            _span = larger;
+        }
+    }
+}
@@ -0,0 +1,173 @@
+using System;
+using System.Collections.Generic;
+using System.Threading;
+using System.Threading.Tasks;
+using CycloneDDS.Runtime.Interop;
+
+namespace CycloneDDS.Runtime
+{
+    /// <summary>
+    /// Serves the acknowledgment waits of one writer on a single background thread, started on first use.
+    /// </summary>
+    /// <remarks>
+    /// Each request carries the sequence number of the last sample written when it was made, so it waits
+    /// for exactly those samples (<c>dds_wait_for_acks_seq</c>) no matter how much is written meanwhile.
+    /// Requests are served in order, which is also the order of their sequence numbers: by the time one is
+    /// reached the earlier ones are done. The native wait is issued in slices so a cancelled request or
+    /// the disposal of the writer is noticed; re-issuing it for the same sequence number does not widen it.
+    /// </remarks>
+    internal sealed class AckWaiter : IDisposable
+    {
+        private static readonly TimeSpan Slice = TimeSpan.FromMilliseconds(100);
+
+        private readonly DdsApi.DdsEntity _writer;
+        private readonly string _name;
+        private readonly Queue<Request> _requests = new Queue<Request>();
+        private Thread? _thread;
+        private bool _disposed;
+
+        public AckWaiter(DdsApi.DdsEntity writer, string name)
+        {
+            _writer = writer;
+            _name = name;
+        }
+
+        /// <summary>
+        /// Completes with true once the samples up to <paramref name="seq"/> are acknowledged,
+        /// false when <paramref name="timeout"/> expires first.
+        /// </summary>
+        public Task<bool> WaitAsync(ulong seq, TimeSpan timeout, CancellationToken cancellationToken)
+        {
+            var request = new Request(seq, timeout, cancellationToken);
+
+            lock (_requests)
+            {
+                if (_disposed) throw new ObjectDisposedException(nameof(DdsWriter<object>));
+
+                _requests.Enqueue(request);
+                if (_thread == null)
+                {
+                    _thread = new Thread(Run) { IsBackground = true, Name = $"AckWaiter({_name})" };
+                    _thread.Start();
+                }
+                Monitor.Pulse(_requests);
+            }
+            return request.Completion.Task;
+        }
+
+        private void Run()
+        {
+            while (true)
+            {
+                Request request;
+                lock (_requests)
+                {
+                    while (_requests.Count == 0 && !_disposed) Monitor.Wait(_requests);
+                    if (_disposed) return;
+                    request = _requests.Dequeue();
+                }
+
+                try
+                {
+                    Serve(request);
+                }
+                catch (Exception ex)
+                {
+                    request.Completion.TrySetException(ex);
+                }
+                request.Dispose();
+            }
+        }
+
+        private void Serve(Request request)
+        {
+            while (!request.Completion.Task.IsCompleted)
+            {
+                long remaining = request.Deadline - Environment.TickCount64;
+                if (remaining <= 0)
+                {
+                    request.Completion.TrySetResult(false);
+                    return;
+                }
+
+                long sliceMs = Math.Min(remaining, (long)Slice.TotalMilliseconds);
+                int ret = DdsApi.dds_wait_for_acks_seq(_writer, request.Seq, sliceMs * 1_000_000);
+                if (ret == (int)DdsApi.DdsReturnCode.Ok)
+                {
+                    request.Completion.TrySetResult(true);
+                    return;
+                }
+                if (ret != (int)DdsApi.DdsReturnCode.Timeout)
+                {
+                    throw new DdsException((DdsApi.DdsReturnCode)ret, $"dds_wait_for_acks_seq failed: {ret}");
+                }
+
+                lock (_requests)
+                {
+                    if (!_disposed) continue;
+                }
+                request.Completion.TrySetException(new ObjectDisposedException(nameof(DdsWriter<object>)));
+                return;
+            }
+        }
+
+        /// <summary>
+        /// Stops the thread and fails outstanding waits; returns once no native wait is running,
+        /// so the writer can be deleted afterwards.
+        /// </summary>
+        public void Dispose()
+        {
+            Thread? thread;
+            lock (_requests)
+            {
+                if (_disposed) return;
+                _disposed = true;
+                thread = _thread;
+                Monitor.PulseAll(_requests);
+            }
+
+            thread?.Join();
+
+            lock (_requests)
+            {
+                while (_requests.Count > 0)
+                {
+                    var request = _requests.Dequeue();
+                    request.Completion.TrySetException(new ObjectDisposedException(nameof(DdsWriter<object>)));
+                    request.Dispose();
+                }
+            }
+        }
+
+        private sealed class Request : IDisposable
+        {
+            public readonly ulong Seq;
+            public readonly long Deadline;
+            public readonly TaskCompletionSource<bool> Completion =
+                new TaskCompletionSource<bool>(TaskCreationOptions.RunContinuationsAsynchronously);
+            private readonly CancellationToken _cancellationToken;
+            private readonly CancellationTokenRegistration _cancellation;
+
+            public Request(ulong seq, TimeSpan timeout, CancellationToken cancellationToken)
+            {
+                Seq = seq;
+                Deadline = timeout == Timeout.InfiniteTimeSpan
+                    ? long.MaxValue
+                    : Environment.TickCount64 + (long)Math.Ceiling(timeout.TotalMilliseconds);
+
+                // The waiter drops a cancelled request at its next slice
+                _cancellationToken = cancellationToken;
+                if (cancellationToken.CanBeCanceled)
+                {
+                    _cancellation = cancellationToken.Register(static state =>
+                    {
+                        var request = (Request)state!;
+                        request.Completion.TrySetCanceled(request._cancellationToken);
+                    }, this);
+                }
+            }
+
+            public void Dispose() => _cancellation.Dispose();
+        }
+    }
+}
@@ -0,0 +1,236 @@
+using System;
+using System.Diagnostics;
+using System.Threading;
+using CycloneDDS.Runtime.Memory;
+
+namespace CycloneDDS.Runtime
+{
+    /// <summary>
+    /// What <see cref="AsyncDdsWriter{T}.Enqueue"/> does when the queue is full.
+    /// </summary>
+    public enum AsyncWriterOverflowPolicy
+    {
+        /// <summary>Wait (spinning, then yielding) until the writer thread frees a slot.</summary>
+        Block,
+        /// <summary>Evict the oldest queued sample to make room.</summary>
+        DropOldest,
+        /// <summary>Discard the new sample; <see cref="AsyncDdsWriter{T}.Enqueue"/> returns false.</summary>
+        DropNewest
+    }
+
+    /// <summary>
+    /// Moves serialization and <c>dds_writecdr</c> off the caller's thread. Producers copy samples into
+    /// a preallocated ring; a dedicated thread drains it in batches through the wrapped
+    /// <see cref="DdsWriter{T}"/> and flushes after each batch.
+    /// The wrapped writer is not disposed with this object.
+    /// </summary>
+    public sealed class AsyncDdsWriter<T> : IDisposable
+    {
+        private readonly DdsWriter<T> _writer;
+        private readonly BoundedRingQueue<T> _queue;
+        private readonly AsyncWriterOverflowPolicy _overflow;
+        private readonly int _batchSize;
+        private readonly Thread _thread;
+
+        // Writer thread parks here when the queue is empty
+        private readonly ParkingSignal _parking = new ParkingSignal();
+        private volatile bool _stopping;
+        private volatile bool _batchInProgress;
+
+        // Producers inside Enqueue; Dispose waits for them so no sample lands after the final drain
+        private int _activeProducers;
+
+        private long _enqueued;
+        private long _written;
+        private long _dropped;
+        private long _failed;
+        private int _maxDepth;
+        private Exception? _lastError;
+
+        /// <param name="writer">Writer used on the background thread.</param>
+        /// <param name="capacity">Queue capacity in samples (rounded up to a power of two).</param>
+        /// <param name="overflow">Behaviour when the queue is full.</param>
+        /// <param name="batchSize">Samples written between flushes.</param>
+        public AsyncDdsWriter(DdsWriter<T> writer, int capacity = 4096,
+            AsyncWriterOverflowPolicy overflow = AsyncWriterOverflowPolicy.Block, int batchSize = 64)
+        {
+            if (writer == null) throw new ArgumentNullException(nameof(writer));
+            if (batchSize <= 0) throw new ArgumentOutOfRangeException(nameof(batchSize));
+
+            _writer = writer;
+            _queue = new BoundedRingQueue<T>(capacity);
+            _overflow = overflow;
+            _batchSize = batchSize;
+
+            _thread = new Thread(Run)
+            {
+                IsBackground = true,
+                Name = $"AsyncDdsWriter<{typeof(T).Name}>"
+            };
+            _thread.Start();
+        }
+
+        /// <summary>Samples currently queued.</summary>
+        public int QueueDepth => _queue.Count;
+
+        /// <summary>Highest queue depth observed.</summary>
+        public int MaxQueueDepth => Volatile.Read(ref _maxDepth);
+
+        public int Capacity => _queue.Capacity;
+
+        /// <summary>Samples accepted into the queue.</summary>
+        public long Enqueued => Interlocked.Read(ref _enqueued);
+
+        /// <summary>Samples written by the background thread.</summary>
+        public long Written => Interlocked.Read(ref _written);
+
+        /// <summary>Samples discarded by the overflow policy.</summary>
+        public long Dropped => Interlocked.Read(ref _dropped);
+
+        /// <summary>Samples whose write threw; see <see cref="LastError"/>.</summary>
+        public long Failed => Interlocked.Read(ref _failed);
+
+        /// <summary>Most recent exception from the background write, if any.</summary>
+        public Exception? LastError => Volatile.Read(ref _lastError);
+
+        /// <summary>
+        /// Copies the sample into the queue. Returns false only when it was discarded
+        /// (<see cref="AsyncWriterOverflowPolicy.DropNewest"/>).
+        /// </summary>
+        public bool Enqueue(in T sample)
+        {
+            Interlocked.Increment(ref _activeProducers); // full fence before reading _stopping
+            try
+            {
+                if (_stopping) throw new ObjectDisposedException(nameof(AsyncDdsWriter<T>));
+                return EnqueueCore(sample);
+            }
+            finally
+            {
+                Interlocked.Decrement(ref _activeProducers);
+            }
+        }
+
+        private bool EnqueueCore(in T sample)
+        {
+            if (!_queue.TryEnqueue(sample))
+            {
+                switch (_overflow)
+                {
+                    case AsyncWriterOverflowPolicy.DropNewest:
+                        Interlocked.Increment(ref _dropped);
+                        return false;
+
+                    case AsyncWriterOverflowPolicy.DropOldest:
+                        while (!_queue.TryEnqueue(sample))
+                        {
+                            if (_queue.TryDequeue(out _)) Interlocked.Increment(ref _dropped);
+                        }
+                        break;
+
+                    default:
+                        var spinner = new SpinWait();
+                        while (!_queue.TryEnqueue(sample))
+                        {
+                            if (_stopping) throw new ObjectDisposedException(nameof(AsyncDdsWriter<T>));
+                            Wake();
+                            spinner.SpinOnce();
+                        }
+                        break;
+                }
+            }
+
+            Interlocked.Increment(ref _enqueued);
+
+            int depth = _queue.Count;
+            int max = Volatile.Read(ref _maxDepth);
+            while (depth > max)
+            {
+                int observed = Interlocked.CompareExchange(ref _maxDepth, depth, max);
+                if (observed == max) break;
+                max = observed;
+            }
+
+            Wake();
+            return true;
+        }
+
+        /// <summary>
+        /// Blocks until everything enqueued so far has been handed to the writer, or the timeout expires.
+        /// </summary>
+        public bool WaitForDrain(TimeSpan timeout)
+        {
+            var sw = Stopwatch.StartNew();
+            var spinner = new SpinWait();
+            while (_queue.Count > 0 || _batchInProgress)
+            {
+                if (sw.Elapsed > timeout) return false;
+                Wake();
+                spinner.SpinOnce();
+            }
+            return true;
+        }
+
+        private void Wake() => _parking.Wake();
+
+        private void Run()
+        {
+            while (true)
+            {
+                _batchInProgress = true;
+                int count = 0;
+                while (count < _batchSize && _queue.TryDequeue(out var sample))
+                {
+                    try
+                    {
+                        _writer.Write(sample);
+                        Interlocked.Increment(ref _written);
+                    }
+                    catch (Exception ex)
+                    {
+                        Interlocked.Increment(ref _failed);
+                        Volatile.Write(ref _lastError, ex);
+                    }
+                    count++;
+                }
+
+                if (count > 0)
+                {
+                    try
+                    {
+                        _writer.Flush();
+                    }
+                    catch (Exception ex)
+                    {
+                        Volatile.Write(ref _lastError, ex);
+                    }
+                }
+                _batchInProgress = false;
+
+                if (count > 0) continue;
+                if (_stopping) return;
+
+                _parking.Park(this, static self => self._queue.Count == 0 && !self._stopping);
+            }
+        }
+
+        /// <summary>
+        /// Stops accepting samples, waits for enqueues already in progress, writes what is queued
+        /// and joins the writer thread.
+        /// </summary>
+        public void Dispose()
+        {
+            if (_stopping) return;
+            _stopping = true;
+            Interlocked.MemoryBarrier();
+
+            // A producer that passed the _stopping check before it was raised finishes its enqueue first
+            var spinner = new SpinWait();
+            while (Volatile.Read(ref _activeProducers) != 0) spinner.SpinOnce();
+
+            _parking.Release();
+            _thread.Join();
+            _parking.Dispose();
+        }
+    }
+}
@@ -0,0 +1,18 @@
+using CycloneDDS.Schema;
+
+namespace CycloneDDS.Runtime.Blobs
+{
+    /// <summary>
+    /// Cumulative acknowledgment of a <see cref="BlobChannel"/> transfer, published by the receiver.
+    /// </summary>
+    [DdsTopic("__FcdcBlobAck")]
+    [DdsExtensibility(DdsExtensibilityKind.Final)]
+    public partial struct BlobAck
+    {
+        [DdsKey]
+        public long TransferId;
+
+        /// <summary>Number of chunks received without gaps, counted from chunk 0.</summary>
+        public int ChunksReceived;
+    }
+}
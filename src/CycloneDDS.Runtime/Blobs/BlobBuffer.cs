@@ -0,0 +1,109 @@
+using System;
+using System.Buffers;
+using System.IO;
+using CycloneDDS.Runtime.Memory;
+
+namespace CycloneDDS.Runtime.Blobs
+{
+    /// <summary>
+    /// A received blob held in pooled segments. Dispose returns the segments to the arena;
+    /// sequences and spans obtained from it are invalid afterwards.
+    /// </summary>
+    public sealed class BlobBuffer : IBlobTarget, IDisposable
+    {
+        internal const int SegmentSize = 1 << 20;
+
+        private byte[][]? _segments;
+
+        internal BlobBuffer(long transferId, long length)
+        {
+            TransferId = transferId;
+            Length = length;
+
+            long count = (length + SegmentSize - 1) / SegmentSize;
+            _segments = new byte[count][];
+            for (long i = 0; i < count; i++)
+            {
+                _segments[i] = Arena.Rent(SegmentSize);
+            }
+        }
+
+        public long TransferId { get; }
+
+        public long Length { get; }
+
+        private byte[][] Segments => _segments ?? throw new ObjectDisposedException(nameof(BlobBuffer));
+
+        /// <summary>
+        /// The blob as a sequence over the pooled segments, without copying.
+        /// </summary>
+        public ReadOnlySequence<byte> AsSequence()
+        {
+            var segments = Segments;
+            if (Length == 0) return ReadOnlySequence<byte>.Empty;
+            if (segments.Length == 1) return new ReadOnlySequence<byte>(segments[0], 0, (int)Length);
+
+            var first = new Segment(segments[0], SegmentSize, 0);
+            var last = first;
+            for (int i = 1; i < segments.Length; i++)
+            {
+                int size = (int)Math.Min(SegmentSize, Length - (long)i * SegmentSize);
+                last = last.Append(segments[i], size);
+            }
+            return new ReadOnlySequence<byte>(first, 0, last, last.Memory.Length);
+        }
+
+        public void CopyTo(Stream destination)
+        {
+            if (destination == null) throw new ArgumentNullException(nameof(destination));
+            foreach (var memory in AsSequence())
+            {
+                destination.Write(memory.Span);
+            }
+        }
+
+        void IBlobTarget.Write(long offset, ReadOnlySpan<byte> data)
+        {
+            var segments = Segments;
+            if (offset < 0 || offset + data.Length > Length)
+            {
+                throw new InvalidDataException($"Chunk at {offset} (+{data.Length}) is outside the blob of {Length} bytes.");
+            }
+
+            // A chunk may straddle two segments
+            while (!data.IsEmpty)
+            {
+                int index = (int)(offset / SegmentSize);
+                int start = (int)(offset % SegmentSize);
+                int count = Math.Min(data.Length, SegmentSize - start);
+
+                data.Slice(0, count).CopyTo(segments[index].AsSpan(start));
+                data = data.Slice(count);
+                offset += count;
+            }
+        }
+
+        public void Dispose()
+        {
+            if (_segments == null) return;
+            foreach (var segment in _segments) Arena.Return(segment);
+            _segments = null;
+        }
+
+        private sealed class Segment : ReadOnlySequenceSegment<byte>
+        {
+            public Segment(byte[] buffer, int length, long runningIndex)
+            {
+                Memory = new ReadOnlyMemory<byte>(buffer, 0, length);
+                RunningIndex = runningIndex;
+            }
+
+            public Segment Append(byte[] buffer, int length)
+            {
+                var next = new Segment(buffer, length, RunningIndex + Memory.Length);
+                Next = next;
+                return next;
+            }
+        }
+    }
+}
@@ -0,0 +1,516 @@
+using System;
+using System.Buffers;
+using System.Buffers.Binary;
+using System.IO;
+using System.Threading;
+using System.Threading.Tasks;
+using CycloneDDS.Core;
+using CycloneDDS.Runtime.Interop;
+using CycloneDDS.Runtime.Memory;
+
+namespace CycloneDDS.Runtime.Blobs
+{
+    /// <summary>
+    /// Progress of a blob transfer, reported per chunk (sender: acknowledged, receiver: received).
+    /// </summary>
+    public readonly struct BlobTransferProgress
+    {
+        public BlobTransferProgress(long transferId, long bytesTransferred, long totalLength)
+        {
+            TransferId = transferId;
+            BytesTransferred = bytesTransferred;
+            TotalLength = totalLength;
+        }
+
+        public long TransferId { get; }
+        public long BytesTransferred { get; }
+        public long TotalLength { get; }
+    }
+
+    /// <summary>
+    /// Moves large blobs (model weights, recordings) over DDS as a stream of fixed-size chunks,
+    /// without one contiguous buffer on either side.
+    /// </summary>
+    /// <remarks>
+    /// <para>
+    /// The sender reads each chunk straight into a pooled CDR buffer behind a hand-written
+    /// <see cref="BlobChunk"/> header and publishes it raw. At most <c>window</c> chunks are unacknowledged:
+    /// the receiver publishes cumulative <see cref="BlobAck"/>s after every batch it takes.
+    /// The receiver reads chunks through a <see cref="DdsRawReader"/> and copies the payload from the serdata
+    /// to its final place (pooled segments or a memory-mapped file), so no managed allocation happens per chunk.
+    /// </para>
+    /// <para>
+    /// Chunk CDR (XCDR1, offsets after the 4-byte header): TransferId @0, ChunkIndex @8,
+    /// ChunkCount @12, TotalLength @16, Offset @24, payload length @32, payload @36.
+    /// This side sends little-endian; the receiver byte-swaps the fixed header of big-endian chunks.
+    /// </para>
+    /// <para>
+    /// Transfers on one channel are sequential: a receiver follows one transfer at a time and ignores chunks of others.
+    /// It only adopts a transfer at chunk 0, so a receiver started mid-transfer waits for the next one.
+    /// A sender that fails or is cancelled publishes an abort chunk (ChunkIndex -1, no payload); the receiver
+    /// then discards the partial transfer and waits for the next one. The first chunk of a new transfer
+    /// likewise replaces one that never completed.
+    /// The sending and receiving sides are created on first use.
+    /// </para>
+    /// </remarks>
+    public sealed class BlobChannel : IDisposable
+    {
+        private const int HeaderSize = 4;
+        private const int ChunkHeaderSize = 36;
+        private const int PayloadOffset = HeaderSize + ChunkHeaderSize;
+        private const int AbortIndex = -1;
+
+        private readonly DdsParticipant _participant;
+        private readonly string _chunkTopic;
+        private readonly string _ackTopic;
+        private readonly int _chunkSize;
+        private readonly int _window;
+        private readonly object _sideLock = new object();
+        private readonly SemaphoreSlim _sendLock = new SemaphoreSlim(1, 1);
+        private readonly SemaphoreSlim _receiveLock = new SemaphoreSlim(1, 1);
+
+        // Sending side
+        private DdsWriter<BlobChunk>? _chunkWriter;
+        private DdsReader<BlobAck, BlobAck>? _ackReader;
+        private int _acked;
+
+        // Receiving side
+        private DdsRawReader? _chunkReader;
+        private DdsWriter<BlobAck>? _ackWriter;
+
+        private bool _disposed;
+
+        /// <param name="participant">Participant owning the readers and writers.</param>
+        /// <param name="channelName">Name of the chunk topic; acknowledgments use <c>channelName + "_Ack"</c>.</param>
+        /// <param name="chunkSize">Payload bytes per chunk.</param>
+        /// <param name="window">Maximum number of unacknowledged chunks per transfer.</param>
+        public BlobChannel(DdsParticipant participant, string channelName, int chunkSize = 64 * 1024, int window = 32)
+        {
+            if (participant == null) throw new ArgumentNullException(nameof(participant));
+            if (string.IsNullOrEmpty(channelName)) throw new ArgumentException("Channel name is required.", nameof(channelName));
+            if (chunkSize <= 0 || chunkSize > int.MaxValue - PayloadOffset) throw new ArgumentOutOfRangeException(nameof(chunkSize));
+            if (window <= 0) throw new ArgumentOutOfRangeException(nameof(window));
+
+            _participant = participant;
+            _chunkTopic = channelName;
+            _ackTopic = channelName + "_Ack";
+            _chunkSize = chunkSize;
+            _window = window;
+        }
+
+        /// <summary>
+        /// How long the sender waits for a receiver to match and for each acknowledgment.
+        /// </summary>
+        public TimeSpan Timeout { get; set; } = TimeSpan.FromSeconds(10);
+
+        public int ChunkSize => _chunkSize;
+
+        public int Window => _window;
+
+        /// <summary>
+        /// Sends <paramref name="data"/> and completes when the receiver has acknowledged all of it.
+        /// Returns the transfer id.
+        /// </summary>
+        /// <exception cref="TimeoutException">No receiver matched, or an acknowledgment did not arrive within <see cref="Timeout"/>.</exception>
+        public Task<long> SendAsync(ReadOnlySequence<byte> data, IProgress<BlobTransferProgress>? progress = null,
+            CancellationToken cancellationToken = default)
+        {
+            return SendCoreAsync(data.Length, (buffer, offset, count) =>
+            {
+                data.Slice(offset, count).CopyTo(buffer.AsSpan(PayloadOffset, count));
+                return ValueTask.CompletedTask;
+            }, progress, cancellationToken);
+        }
+
+        /// <summary>
+        /// Sends the rest of a seekable stream (see <see cref="SendAsync(Stream, long, IProgress{BlobTransferProgress}?, CancellationToken)"/>).
+        /// </summary>
+        /// <exception cref="NotSupportedException">The stream cannot seek; pass the length explicitly.</exception>
+        public Task<long> SendAsync(Stream source, IProgress<BlobTransferProgress>? progress = null,
+            CancellationToken cancellationToken = default)
+        {
+            if (source == null) throw new ArgumentNullException(nameof(source));
+            if (!source.CanSeek) throw new NotSupportedException("The length of a non-seekable stream must be given explicitly.");
+            return SendAsync(source, source.Length - source.Position, progress, cancellationToken);
+        }
+
+        /// <summary>
+        /// Sends <paramref name="length"/> bytes read from <paramref name="source"/>; each chunk is read
+        /// directly into the pooled buffer it is published from.
+        /// </summary>
+        /// <exception cref="EndOfStreamException">The stream ended before <paramref name="length"/> bytes.</exception>
+        public Task<long> SendAsync(Stream source, long length, IProgress<BlobTransferProgress>? progress = null,
+            CancellationToken cancellationToken = default)
+        {
+            if (source == null) throw new ArgumentNullException(nameof(source));
+            if (length < 0) throw new ArgumentOutOfRangeException(nameof(length));
+
+            return SendCoreAsync(length, (buffer, offset, count) =>
+                source.ReadExactlyAsync(buffer.AsMemory(PayloadOffset, count), cancellationToken), progress, cancellationToken);
+        }
+
+        private async Task<long> SendCoreAsync(long length, Func<byte[], long, int, ValueTask> fill,
+            IProgress<BlobTransferProgress>? progress, CancellationToken cancellationToken)
+        {
+            EnsureSender();
+            await _sendLock.WaitAsync(cancellationToken).ConfigureAwait(false);
+
+            byte[] buffer = Arena.Rent(PayloadOffset + _chunkSize);
+            long transferId = 0;
+            try
+            {
+                if (!await _chunkWriter!.WaitForReaderAsync(Timeout).ConfigureAwait(false))
+                {
+                    throw new TimeoutException($"No receiver matched blob channel '{_chunkTopic}' within {Timeout}.");
+                }
+
+                do { transferId = Random.Shared.NextInt64(); } while (transferId == 0);
+
+                long chunkCount = Math.Max(1, (length + _chunkSize - 1) / _chunkSize);
+                if (chunkCount > int.MaxValue) throw new ArgumentOutOfRangeException(nameof(length), "Blob needs more than int.MaxValue chunks.");
+
+                Volatile.Write(ref _acked, 0);
+                for (int index = 0; index < chunkCount; index++)
+                {
+                    cancellationToken.ThrowIfCancellationRequested();
+
+                    if (index - Volatile.Read(ref _acked) >= _window)
+                    {
+                        _chunkWriter.Flush();
+                        await WaitForAckAsync(transferId, index - _window + 1, length, progress, cancellationToken).ConfigureAwait(false);
+                    }
+
+                    long offset = (long)index * _chunkSize;
+                    int count = (int)Math.Min(_chunkSize, length - offset);
+
+                    await fill(buffer, offset, count).ConfigureAwait(false);
+                    PublishChunk(buffer, transferId, index, (int)chunkCount, length, offset, count);
+                }
+
+                _chunkWriter.Flush();
+                await WaitForAckAsync(transferId, (int)chunkCount, length, progress, cancellationToken).ConfigureAwait(false);
+                return transferId;
+            }
+            catch
+            {
+                if (transferId != 0) PublishAbort(buffer, transferId, length);
+                throw;
+            }
+            finally
+            {
+                Arena.Return(buffer);
+                _sendLock.Release();
+            }
+        }
+
+        private void PublishChunk(byte[] buffer, long transferId, int index, int chunkCount, long totalLength, long offset, int count)
+        {
+            // Header only; the payload is already at PayloadOffset
+            var cdr = new CdrWriter(buffer.AsSpan(0, PayloadOffset), CdrEncoding.Xcdr1, origin: HeaderSize);
+            cdr.WriteByte(0x00);
+            cdr.WriteByte(0x01); // CDR_LE: CdrWriter is little-endian on every host
+            cdr.WriteByte(0x00);
+            cdr.WriteByte(0x00);
+            cdr.WriteInt64(transferId);
+            cdr.WriteInt32(index);
+            cdr.WriteInt32(chunkCount);
+            cdr.WriteInt64(totalLength);
+            cdr.WriteInt64(offset);
+            cdr.WriteUInt32((uint)count);
+            cdr.Complete();
+
+            _chunkWriter!.WriteRaw(buffer.AsSpan(0, PayloadOffset + count));
+        }
+
+        // Tells the receiver to drop the partial transfer; best effort, the original failure is what gets reported
+        private void PublishAbort(byte[] buffer, long transferId, long totalLength)
+        {
+            try
+            {
+                PublishChunk(buffer, transferId, AbortIndex, 0, totalLength, 0, 0);
+                _chunkWriter!.Flush();
+            }
+            catch (Exception)
+            {
+            }
+        }
+
+        private async Task WaitForAckAsync(long transferId, int chunks, long totalLength,
+            IProgress<BlobTransferProgress>? progress, CancellationToken cancellationToken)
+        {
+            using var timeout = CancellationTokenSource.CreateLinkedTokenSource(cancellationToken);
+            timeout.CancelAfter(Timeout);
+
+            while (true)
+            {
+                int before = Volatile.Read(ref _acked);
+                int acked = DrainAcks(transferId);
+                if (acked > before && progress != null)
+                {
+                    progress.Report(new BlobTransferProgress(transferId, Math.Min(totalLength, (long)acked * _chunkSize), totalLength));
+                }
+                if (acked >= chunks) return;
+
+                try
+                {
+                    await _ackReader!.WaitDataAsync(timeout.Token).ConfigureAwait(false);
+                }
+                catch (OperationCanceledException) when (!cancellationToken.IsCancellationRequested)
+                {
+                    throw new TimeoutException($"Blob transfer {transferId} on '{_chunkTopic}' was not acknowledged within {Timeout}.");
+                }
+            }
+        }
+
+        private int DrainAcks(long transferId)
+        {
+            int acked = Volatile.Read(ref _acked);
+            using var scope = _ackReader!.Take();
+            for (int i = 0; i < scope.Count; i++)
+            {
+                var ack = scope[i];
+                if (ack.TransferId == transferId && ack.ChunksReceived > acked) acked = ack.ChunksReceived;
+            }
+            Volatile.Write(ref _acked, acked);
+            return acked;
+        }
+
+        /// <summary>
+        /// Receives the next transfer into pooled segments. Dispose the result to return them.
+        /// </summary>
+        public Task<BlobBuffer> ReceiveAsync(IProgress<BlobTransferProgress>? progress = null,
+            CancellationToken cancellationToken = default)
+        {
+            return ReceiveCoreAsync((id, length) => new BlobBuffer(id, length), progress, cancellationToken);
+        }
+
+        /// <summary>
+        /// Receives the next transfer into a memory-mapped file at <paramref name="path"/> (created or overwritten)
+        /// and returns its length.
+        /// </summary>
+        public async Task<long> ReceiveToFileAsync(string path, IProgress<BlobTransferProgress>? progress = null,
+            CancellationToken cancellationToken = default)
+        {
+            if (string.IsNullOrEmpty(path)) throw new ArgumentException("Path is required.", nameof(path));
+
+            long length = 0;
+            using var target = await ReceiveCoreAsync((id, total) =>
+            {
+                length = total;
+                return new MappedFileBlobTarget(path, total);
+            }, progress, cancellationToken).ConfigureAwait(false);
+            return length;
+        }
+
+        private async Task<TTarget> ReceiveCoreAsync<TTarget>(Func<long, long, TTarget> createTarget,
+            IProgress<BlobTransferProgress>? progress, CancellationToken cancellationToken) where TTarget : class, IBlobTarget
+        {
+            EnsureReceiver();
+            await _receiveLock.WaitAsync(cancellationToken).ConfigureAwait(false);
+
+            var transfer = new ReceiveState<TTarget>(createTarget);
+            try
+            {
+                while (true)
+                {
+                    if (DrainChunks(transfer, progress)) return transfer.Target!;
+                    await _chunkReader!.WaitDataAsync(cancellationToken).ConfigureAwait(false);
+                }
+            }
+            catch
+            {
+                transfer.Target?.Dispose();
+                throw;
+            }
+            finally
+            {
+                _receiveLock.Release();
+            }
+        }
+
+        // Takes everything available; returns true once the transfer is complete
+        private bool DrainChunks<TTarget>(ReceiveState<TTarget> transfer, IProgress<BlobTransferProgress>? progress)
+            where TTarget : class, IBlobTarget
+        {
+            using var scope = _chunkReader!.Take(_window);
+            if (scope.Count == 0) return false;
+
+            int before = transfer.Contiguous;
+            for (int i = 0; i < scope.Count; i++)
+            {
+                var cdr = scope.GetCdr(i);
+                if (cdr.Length < PayloadOffset || cdr[0] != 0x00) continue; // no valid data (e.g. sender went away)
+
+                // Odd representation identifiers (CDR_LE, CDR2_LE, ...) are little-endian
+                bool little = (cdr[1] & 0x01) != 0;
+                var header = cdr.Slice(HeaderSize, ChunkHeaderSize);
+                long transferId = ReadInt64(header.Slice(0), little);
+                int index = ReadInt32(header.Slice(8), little);
+                int chunkCount = ReadInt32(header.Slice(12), little);
+                long totalLength = ReadInt64(header.Slice(16), little);
+                long offset = ReadInt64(header.Slice(24), little);
+                uint count = ReadUInt32(header.Slice(32), little);
+
+                if (transferId != transfer.TransferId)
+                {
+                    // Earlier chunks of a transfer already under way are gone; wait for the next one.
+                    // Transfers are sequential, so the first chunk of a new one also ends an abandoned one.
+                    if (index != 0) continue;
+                    transfer.Reset();
+                    before = 0;
+                    transfer.Start(transferId, chunkCount, totalLength);
+                }
+
+                if (index == AbortIndex)
+                {
+                    transfer.Reset();
+                    before = 0;
+                    continue;
+                }
+
+                if ((uint)index >= (uint)transfer.Received.Length || transfer.Received[index]) continue;
+                if (count > (uint)(cdr.Length - PayloadOffset)) throw new InvalidDataException("Blob chunk payload is truncated.");
+
+                transfer.Target!.Write(offset, cdr.Slice(PayloadOffset, (int)count));
+                transfer.Received[index] = true;
+                transfer.Bytes += count;
+            }
+
+            while (transfer.Contiguous < transfer.Received.Length && transfer.Received[transfer.Contiguous])
+            {
+                transfer.Contiguous++;
+            }
+
+            if (transfer.Contiguous > before)
+            {
+                _ackWriter!.Write(new BlobAck { TransferId = transfer.TransferId, ChunksReceived = transfer.Contiguous });
+                progress?.Report(new BlobTransferProgress(transfer.TransferId, transfer.Bytes, transfer.TotalLength));
+            }
+
+            return transfer.TransferId != 0 && transfer.Contiguous == transfer.Received.Length;
+        }
+
+        private static int ReadInt32(ReadOnlySpan<byte> data, bool little)
+        {
+            return little ? BinaryPrimitives.ReadInt32LittleEndian(data) : BinaryPrimitives.ReadInt32BigEndian(data);
+        }
+
+        private static uint ReadUInt32(ReadOnlySpan<byte> data, bool little)
+        {
+            return little ? BinaryPrimitives.ReadUInt32LittleEndian(data) : BinaryPrimitives.ReadUInt32BigEndian(data);
+        }
+
+        private static long ReadInt64(ReadOnlySpan<byte> data, bool little)
+        {
+            return little ? BinaryPrimitives.ReadInt64LittleEndian(data) : BinaryPrimitives.ReadInt64BigEndian(data);
+        }
+
+        private sealed class ReceiveState<TTarget> where TTarget : class, IBlobTarget
+        {
+            private readonly Func<long, long, TTarget> _createTarget;
+
+            public ReceiveState(Func<long, long, TTarget> createTarget)
+            {
+                _createTarget = createTarget;
+            }
+
+            public long TransferId;
+            public long TotalLength;
+            public long Bytes;
+            public int Contiguous;
+            public bool[] Received = Array.Empty<bool>();
+            public TTarget? Target;
+
+            public void Start(long transferId, int chunkCount, long totalLength)
+            {
+                if (chunkCount <= 0 || totalLength < 0) throw new InvalidDataException("Invalid blob chunk header.");
+
+                Target = _createTarget(transferId, totalLength);
+                TransferId = transferId;
+                TotalLength = totalLength;
+                Received = new bool[chunkCount];
+            }
+
+            // Aborted or abandoned by the sender: drop what arrived
+            public void Reset()
+            {
+                Target?.Dispose();
+                Target = null;
+                TransferId = 0;
+                TotalLength = 0;
+                Bytes = 0;
+                Contiguous = 0;
+                Received = Array.Empty<bool>();
+            }
+        }
+
+        private void EnsureSender()
+        {
+            if (_disposed) throw new ObjectDisposedException(nameof(BlobChannel));
+            if (_chunkWriter != null) return;
+
+            lock (_sideLock)
+            {
+                if (_chunkWriter != null) return;
+
+                var qos = CreateReliableQos();
+                try
+                {
+                    _ackReader = new DdsReader<BlobAck, BlobAck>(_participant, _ackTopic, qos);
+                    _chunkWriter = new DdsWriter<BlobChunk>(_participant, _chunkTopic, qos);
+                }
+                finally
+                {
+                    DdsApi.dds_delete_qos(qos);
+                }
+            }
+        }
+
+        private void EnsureReceiver()
+        {
+            if (_disposed) throw new ObjectDisposedException(nameof(BlobChannel));
+            if (_chunkReader != null) return;
+
+            lock (_sideLock)
+            {
+                if (_chunkReader != null) return;
+
+                var qos = CreateReliableQos();
+                try
+                {
+                    _ackWriter = new DdsWriter<BlobAck>(_participant, _ackTopic, qos);
+                    _chunkReader = new DdsRawReader(_participant, _chunkTopic, typeof(BlobChunk), qos);
+                }
+                finally
+                {
+                    DdsApi.dds_delete_qos(qos);
+                }
+            }
+        }
+
+        // Reliable KEEP_ALL; writer history stays bounded by the acknowledgment window
+        private static IntPtr CreateReliableQos()
+        {
+            var qos = DdsApi.dds_create_qos();
+            DdsApi.dds_qset_reliability(qos, DdsApi.DDS_RELIABILITY_RELIABLE, 1_000_000_000); // 1 s max blocking
+            DdsApi.dds_qset_history(qos, DdsApi.DDS_HISTORY_KEEP_ALL, 0);
+            return qos;
+        }
+
+        public void Dispose()
+        {
+            if (_disposed) return;
+            _disposed = true;
+
+            lock (_sideLock)
+            {
+                _chunkWriter?.Dispose();
+                _ackReader?.Dispose();
+                _chunkReader?.Dispose();
+                _ackWriter?.Dispose();
+            }
+            _sendLock.Dispose();
+            _receiveLock.Dispose();
+        }
+    }
+}
@@ -0,0 +1,32 @@
+using System.Collections.Generic;
+using CycloneDDS.Schema;
+
+namespace CycloneDDS.Runtime.Blobs
+{
+    /// <summary>
+    /// One chunk of a <see cref="BlobChannel"/> transfer. <see cref="BlobChannel"/> writes and parses
+    /// the CDR of this type directly (see <see cref="BlobChannel"/> for the layout), so the chunk payload
+    /// is never materialized as <see cref="Data"/> on either side.
+    /// </summary>
+    [DdsTopic("__FcdcBlobChunk")]
+    [DdsExtensibility(DdsExtensibilityKind.Final)]
+    public partial struct BlobChunk
+    {
+        /// <summary>Random transfer identifier; one instance per transfer.</summary>
+        [DdsKey]
+        public long TransferId;
+
+        public int ChunkIndex;
+
+        public int ChunkCount;
+
+        /// <summary>Size of the whole blob in bytes.</summary>
+        public long TotalLength;
+
+        /// <summary>Position of this chunk in the blob.</summary>
+        public long Offset;
+
+        [DdsManaged]
+        public List<byte> Data;
+    }
+}
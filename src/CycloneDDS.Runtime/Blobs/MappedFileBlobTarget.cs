@@ -0,0 +1,79 @@
+using System;
+using System.IO;
+using System.IO.MemoryMappedFiles;
+
+namespace CycloneDDS.Runtime.Blobs
+{
+    /// <summary>
+    /// Destination of a blob transfer: chunks are copied straight from the received serdata to their offset.
+    /// </summary>
+    internal interface IBlobTarget : IDisposable
+    {
+        void Write(long offset, ReadOnlySpan<byte> data);
+    }
+
+    /// <summary>
+    /// Writes a received blob into a memory-mapped file of the final size.
+    /// </summary>
+    internal sealed unsafe class MappedFileBlobTarget : IBlobTarget
+    {
+        private readonly long _length;
+        private MemoryMappedFile? _file;
+        private MemoryMappedViewAccessor? _view;
+        private byte* _base;
+
+        public MappedFileBlobTarget(string path, long length)
+        {
+            _length = length;
+            if (length == 0)
+            {
+                // A zero-capacity mapping is not allowed; an empty file is all there is to write
+                File.Create(path).Dispose();
+                return;
+            }
+
+            try
+            {
+                _file = MemoryMappedFile.CreateFromFile(path, FileMode.Create, null, length, MemoryMappedFileAccess.ReadWrite);
+                _view = _file.CreateViewAccessor(0, length, MemoryMappedFileAccess.ReadWrite);
+                _view.SafeMemoryMappedViewHandle.AcquirePointer(ref _base);
+                _base += _view.PointerOffset;
+            }
+            catch
+            {
+                Dispose();
+                throw;
+            }
+        }
+
+        public void Write(long offset, ReadOnlySpan<byte> data)
+        {
+            if (offset < 0 || offset + data.Length > _length)
+            {
+                throw new InvalidDataException($"Chunk at {offset} (+{data.Length}) is outside the blob of {_length} bytes.");
+            }
+            // The single chunk of an empty blob; there is no mapping to write it to
+            if (data.IsEmpty) return;
+            if (_base == null) throw new ObjectDisposedException(nameof(MappedFileBlobTarget));
+
+            data.CopyTo(new Span<byte>(_base + offset, data.Length));
+        }
+
+        public void Dispose()
+        {
+            if (_view != null)
+            {
+                if (_base != null)
+                {
+                    _view.SafeMemoryMappedViewHandle.ReleasePointer();
+                    _base = null;
+                }
+                _view.Flush();
+                _view.Dispose();
+                _view = null;
+            }
+            _file?.Dispose();
+            _file = null;
+        }
+    }
+}
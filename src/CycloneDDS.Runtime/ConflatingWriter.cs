@@ -0,0 +1,261 @@
+using System;
+using System.Runtime.ExceptionServices;
+using System.Threading;
+using CycloneDDS.Core;
+
+namespace CycloneDDS.Runtime
+{
+    /// <summary>
+    /// Writer-side conflation: <see cref="Update"/> only stores the latest sample per instance,
+    /// and dirty instances are published at a fixed rate (or on <see cref="Flush"/>).
+    /// Intended for producers updating hot keys far faster than consumers need them.
+    /// </summary>
+    /// <remarks>
+    /// Instances live in a fixed-capacity open-addressing table keyed by the generated key hash.
+    /// Slots are claimed with a compare-and-swap and never freed, so <see cref="Update"/> takes no locks
+    /// and does not allocate; the sample copy itself is guarded by a per-slot spin flag.
+    /// When the table is full, updates for new instances are written through directly.
+    /// An update whose write fails stays dirty and is retried on the next flush; the background thread
+    /// records such failures in <see cref="FailedWrites"/> and <see cref="LastError"/>.
+    /// The wrapped writer is not disposed with this object.
+    /// </remarks>
+    public sealed class ConflatingWriter<T> : IDisposable
+    {
+        private const int SlotEmpty = 0;
+        private const int SlotClaiming = 1;
+        private const int SlotReady = 2;
+
+        private readonly DdsWriter<T> _writer;
+        private readonly int _mask;
+
+        private readonly int[] _state;
+        private readonly ulong[] _keyLo;
+        private readonly ulong[] _keyHi;
+        private readonly T[] _values;
+        private readonly int[] _dirty;
+        private readonly int[] _busy;
+
+        private readonly object _flushLock = new object();
+        private readonly Thread? _flushThread;
+        private readonly ManualResetEventSlim _stop = new ManualResetEventSlim(false);
+        private readonly TimeSpan _publishInterval;
+        private int _instanceCount;
+        private long _failedWrites;
+        private Exception? _lastError;
+        private bool _disposed;
+
+        /// <param name="writer">Writer used for publishing.</param>
+        /// <param name="publishInterval">Flush period of the background thread; <see cref="TimeSpan.Zero"/> to flush manually.</param>
+        /// <param name="capacity">Maximum number of conflated instances (rounded up to a power of two).</param>
+        public ConflatingWriter(DdsWriter<T> writer, TimeSpan publishInterval, int capacity = 4096)
+        {
+            if (writer == null) throw new ArgumentNullException(nameof(writer));
+            if (capacity <= 0) throw new ArgumentOutOfRangeException(nameof(capacity));
+            if (publishInterval < TimeSpan.Zero) throw new ArgumentOutOfRangeException(nameof(publishInterval));
+
+            _writer = writer;
+            _publishInterval = publishInterval;
+
+            int size = 1;
+            while (size < capacity) size <<= 1;
+            _mask = size - 1;
+
+            _state = new int[size];
+            _keyLo = new ulong[size];
+            _keyHi = new ulong[size];
+            _values = new T[size];
+            _dirty = new int[size];
+            _busy = new int[size];
+
+            if (publishInterval > TimeSpan.Zero)
+            {
+                _flushThread = new Thread(FlushLoop)
+                {
+                    IsBackground = true,
+                    Name = $"ConflatingWriter<{typeof(T).Name}>"
+                };
+                _flushThread.Start();
+            }
+        }
+
+        /// <summary>Number of instances currently held in the table.</summary>
+        public int InstanceCount => Volatile.Read(ref _instanceCount);
+
+        /// <summary>Capacity of the instance table.</summary>
+        public int Capacity => _mask + 1;
+
+        /// <summary>Writes that threw during a flush; the affected updates are kept and retried.</summary>
+        public long FailedWrites => Interlocked.Read(ref _failedWrites);
+
+        /// <summary>Most recent flush failure, or <c>null</c>.</summary>
+        public Exception? LastError => Volatile.Read(ref _lastError);
+
+        /// <summary>
+        /// Stores the sample as the latest value of its instance; it is published on the next flush.
+        /// </summary>
+        public void Update(in T sample)
+        {
+            if (_disposed) throw new ObjectDisposedException(nameof(ConflatingWriter<T>));
+
+            Span<byte> digest = stackalloc byte[KeyHashWriter.HashSize];
+            _writer.ComputeInstanceDigest(sample, digest);
+            var (lo, hi) = InstanceDigest.Read(digest);
+
+            int slot = FindOrClaimSlot(lo, hi);
+            if (slot < 0)
+            {
+                // Table full: no conflation for this instance
+                _writer.Write(sample);
+                return;
+            }
+
+            AcquireSlot(slot);
+            _values[slot] = sample;
+            Volatile.Write(ref _dirty[slot], 1);
+            Volatile.Write(ref _busy[slot], 0);
+        }
+
+        /// <summary>
+        /// Writes every instance updated since the last flush and returns how many were written.
+        /// </summary>
+        /// <remarks>
+        /// Every dirty instance is attempted; failed ones stay dirty, and the first failure is rethrown
+        /// once the pass is complete.
+        /// </remarks>
+        public int Flush()
+        {
+            int written = FlushPending(out var error);
+            if (error != null) ExceptionDispatchInfo.Throw(error);
+            return written;
+        }
+
+        private int FlushPending(out Exception? error)
+        {
+            error = null;
+            lock (_flushLock)
+            {
+                int written = 0;
+                for (int i = 0; i <= _mask; i++)
+                {
+                    if (Volatile.Read(ref _state[i]) != SlotReady) continue;
+                    if (Interlocked.Exchange(ref _dirty[i], 0) == 0) continue;
+
+                    AcquireSlot(i);
+                    T sample = _values[i];
+                    Volatile.Write(ref _busy[i], 0);
+
+                    try
+                    {
+                        _writer.Write(sample);
+                        written++;
+                    }
+                    catch (Exception ex)
+                    {
+                        // Leave the instance dirty so the next flush retries it (or a newer update)
+                        Volatile.Write(ref _dirty[i], 1);
+                        RecordFailure(ex);
+                        error ??= ex;
+                    }
+                }
+
+                if (written > 0)
+                {
+                    try
+                    {
+                        _writer.Flush();
+                    }
+                    catch (Exception ex)
+                    {
+                        RecordFailure(ex);
+                        error ??= ex;
+                    }
+                }
+                return written;
+            }
+        }
+
+        private void RecordFailure(Exception ex)
+        {
+            Interlocked.Increment(ref _failedWrites);
+            Volatile.Write(ref _lastError, ex);
+        }
+
+        private int FindOrClaimSlot(ulong lo, ulong hi)
+        {
+            int index = (int)InstanceDigest.Mix(lo, hi) & _mask;
+            var spinner = new SpinWait();
+
+            for (int probe = 0; probe <= _mask; )
+            {
+                int state = Volatile.Read(ref _state[index]);
+                if (state == SlotReady)
+                {
+                    if (_keyLo[index] == lo && _keyHi[index] == hi) return index;
+                }
+                else if (state == SlotEmpty)
+                {
+                    if (Interlocked.CompareExchange(ref _state[index], SlotClaiming, SlotEmpty) == SlotEmpty)
+                    {
+                        _keyLo[index] = lo;
+                        _keyHi[index] = hi;
+                        Volatile.Write(ref _state[index], SlotReady);
+                        Interlocked.Increment(ref _instanceCount);
+                        return index;
+                    }
+                    continue; // lost the race, look at the slot again
+                }
+                else
+                {
+                    // Another producer is publishing the key of this slot
+                    spinner.SpinOnce();
+                    continue;
+                }
+
+                index = (index + 1) & _mask;
+                probe++;
+            }
+            return -1;
+        }
+
+        private void AcquireSlot(int slot)
+        {
+            if (Interlocked.CompareExchange(ref _busy[slot], 1, 0) == 0) return;
+
+            var spinner = new SpinWait();
+            while (Interlocked.CompareExchange(ref _busy[slot], 1, 0) != 0)
+            {
+                spinner.SpinOnce();
+            }
+        }
+
+        private void FlushLoop()
+        {
+            while (!_stop.Wait(_publishInterval))
+            {
+                FlushPending(out _);
+            }
+        }
+
+        /// <summary>
+        /// Stops the flush thread and publishes pending updates.
+        /// </summary>
+        public void Dispose()
+        {
+            if (_disposed) return;
+            _disposed = true;
+
+            _stop.Set();
+            _flushThread?.Join();
+            _stop.Dispose();
+
+            try
+            {
+                Flush();
+            }
+            catch (ObjectDisposedException)
+            {
+                // Writer disposed first: pending updates are dropped
+            }
+        }
+    }
+}
@@ -0,0 +1,42 @@
+using System;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+
+namespace CycloneDDS.Runtime
+{
+    /// <summary>
+    /// Receiver of <see cref="DataAvailableListener"/> callbacks; the listener argument is a GCHandle to it.
+    /// </summary>
+    internal interface IDataAvailableTarget
+    {
+        /// <summary>Runs on the Cyclone delivery thread and must not throw.</summary>
+        void OnDataAvailable(int reader);
+    }
+
+    /// <summary>
+    /// Native data-available callback as an <see cref="UnmanagedCallersOnlyAttribute"/> function pointer.
+    /// Cyclone calls it directly, without the reverse P/Invoke delegate stub; generic readers
+    /// (which cannot host such methods) are reached through <see cref="IDataAvailableTarget"/>.
+    /// </summary>
+    internal static unsafe class DataAvailableListener
+    {
+        public static IntPtr Callback => (IntPtr)(delegate* unmanaged[Cdecl]<int, IntPtr, void>)&OnDataAvailable;
+
+        [UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvCdecl) })]
+        private static void OnDataAvailable(int reader, IntPtr arg)
+        {
+            if (arg == IntPtr.Zero) return;
+
+            // Exceptions must not cross into native code
+            try
+            {
+                var handle = GCHandle.FromIntPtr(arg);
+                if (handle.IsAllocated && handle.Target is IDataAvailableTarget target)
+                {
+                    target.OnDataAvailable(reader);
+                }
+            }
+            catch { }
+        }
+    }
+}
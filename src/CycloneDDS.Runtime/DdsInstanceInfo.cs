@@ -0,0 +1,26 @@
+using System;
+
+namespace CycloneDDS.Runtime
+{
+    /// <summary>
+    /// Catalog entry returned by <see cref="DdsReader{T, TView}.GetInstances"/>.
+    /// </summary>
+    public readonly struct DdsInstanceInfo<TView> where TView : struct
+    {
+        internal DdsInstanceInfo(DdsInstanceHandle handle, TView key, DdsInstanceState state)
+        {
+            Handle = handle;
+            Key = key;
+            State = state;
+        }
+
+        public DdsInstanceHandle Handle { get; }
+
+        /// <summary>Sample with only the key members set (decoded by the generated <c>DeserializeKey</c>).</summary>
+        public TView Key { get; }
+
+        public DdsInstanceState State { get; }
+
+        public override string ToString() => $"{Handle} {State}";
+    }
+}
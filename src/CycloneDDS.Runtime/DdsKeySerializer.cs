@@ -0,0 +1,110 @@
+using System;
+using System.Reflection;
+using System.Reflection.Emit;
+using CycloneDDS.Core;
+
+namespace CycloneDDS.Runtime
+{
+    /// <summary>
+    /// Cached thunks for the generated key-only methods (<c>GetKeySerializedSize</c>, <c>SerializeKey</c>,
+    /// <c>ComputeKeyHash</c>). Key-only CDR is what Cyclone expects for SDK_KEY serdata.
+    /// </summary>
+    /// <remarks>
+    /// Whether the key hash is the MD5 of the key stream or the stream itself is taken from the topic
+    /// descriptor's <c>DDS_TOPIC_FIXED_KEY_XCDR2</c> flag, as Cyclone does, rather than from the generator's
+    /// estimate; a disagreement would map one key to two instances.
+    /// </remarks>
+    internal static class DdsKeySerializer<T>
+    {
+        // dds_opcodes.h: the key stream in XCDR2 is at most 16 bytes, so no MD5
+        private const uint DDS_TOPIC_FIXED_KEY_XCDR2 = 1u << 5;
+
+        internal delegate void SerializeKeyDelegate(in T sample, ref CdrWriter writer);
+        internal delegate int GetKeySerializedSizeDelegate(in T sample, int currentOffset, CdrEncoding encoding);
+        internal delegate void ComputeKeyHashDelegate(in T sample, Span<byte> hash16);
+
+        /// <summary>Null when the type has no key serializer (keyless topic).</summary>
+        public static readonly SerializeKeyDelegate? Serializer;
+
+        /// <summary>Null when the type has no key sizer; callers then size with the full-sample sizer.</summary>
+        public static readonly GetKeySerializedSizeDelegate? Sizer;
+
+        /// <summary>Null when the generator could not emit a key hash for the key types used.</summary>
+        public static readonly ComputeKeyHashDelegate? KeyHasher;
+
+        static DdsKeySerializer()
+        {
+            var serialize = typeof(T).GetMethod("SerializeKey", new[] { typeof(CdrWriter).MakeByRefType() });
+            if (serialize != null)
+            {
+                Serializer = (SerializeKeyDelegate)CreateThunk(
+                    "SerializeKeyThunk", serialize, typeof(void),
+                    new[] { typeof(T).MakeByRefType(), typeof(CdrWriter).MakeByRefType() },
+                    typeof(SerializeKeyDelegate));
+            }
+
+            var size = typeof(T).GetMethod("GetKeySerializedSize", new[] { typeof(int), typeof(CdrEncoding) });
+            if (size != null)
+            {
+                Sizer = (GetKeySerializedSizeDelegate)CreateThunk(
+                    "GetKeySerializedSizeThunk", size, typeof(int),
+                    new[] { typeof(T).MakeByRefType(), typeof(int), typeof(CdrEncoding) },
+                    typeof(GetKeySerializedSizeDelegate));
+            }
+
+            var hashWithMode = typeof(T).GetMethod("ComputeKeyHash", BindingFlags.Public | BindingFlags.Static,
+                new[] { typeof(T).MakeByRefType(), typeof(Span<byte>), typeof(bool) });
+            var flagset = typeof(T).GetMethod("GetDescriptorFlagset", BindingFlags.Public | BindingFlags.Static, Type.EmptyTypes);
+            if (hashWithMode != null && flagset != null && flagset.ReturnType == typeof(uint))
+            {
+                bool useMd5 = ((uint)flagset.Invoke(null, null)! & DDS_TOPIC_FIXED_KEY_XCDR2) == 0;
+                KeyHasher = CreateKeyHashThunk(hashWithMode, useMd5);
+                return;
+            }
+
+            // No descriptor: the generator's own estimate. Static, so it binds directly without a thunk
+            var hash = typeof(T).GetMethod("ComputeKeyHash", BindingFlags.Public | BindingFlags.Static,
+                new[] { typeof(T).MakeByRefType(), typeof(Span<byte>) });
+            if (hash != null)
+            {
+                KeyHasher = (ComputeKeyHashDelegate)Delegate.CreateDelegate(typeof(ComputeKeyHashDelegate), hash);
+            }
+        }
+
+        // ComputeKeyHash(in T, Span<byte>, bool) with the mode baked in as a constant
+        private static ComputeKeyHashDelegate CreateKeyHashThunk(MethodInfo method, bool useMd5)
+        {
+            var dm = new DynamicMethod("ComputeKeyHashThunk", typeof(void),
+                new[] { typeof(T).MakeByRefType(), typeof(Span<byte>) }, typeof(DdsKeySerializer<T>).Module);
+
+            var il = dm.GetILGenerator();
+            il.Emit(OpCodes.Ldarg_0);
+            il.Emit(OpCodes.Ldarg_1);
+            il.Emit(useMd5 ? OpCodes.Ldc_I4_1 : OpCodes.Ldc_I4_0);
+            il.Emit(OpCodes.Call, method);
+            il.Emit(OpCodes.Ret);
+
+            return (ComputeKeyHashDelegate)dm.CreateDelegate(typeof(ComputeKeyHashDelegate));
+        }
+
+        private static Delegate CreateThunk(string name, MethodInfo method, Type returnType, Type[] parameters, Type delegateType)
+        {
+            var dm = new DynamicMethod(name, returnType, parameters, typeof(DdsKeySerializer<T>).Module);
+
+            var il = dm.GetILGenerator();
+            il.Emit(OpCodes.Ldarg_0); // sample (ref)
+            if (!typeof(T).IsValueType)
+            {
+                il.Emit(OpCodes.Ldind_Ref);
+            }
+            for (short i = 1; i < parameters.Length; i++)
+            {
+                il.Emit(OpCodes.Ldarg, i);
+            }
+            il.Emit(OpCodes.Call, method);
+            il.Emit(OpCodes.Ret);
+
+            return dm.CreateDelegate(delegateType);
+        }
+    }
+}
@@ -1,8 +1,10 @@
 using System;
 using System.Collections.Generic;
+using System.Reflection;
 using System.Runtime.InteropServices;
 using CycloneDDS.Runtime.Interop;
 using CycloneDDS.Runtime.Tracking;
+using CycloneDDS.Schema;
 
 namespace CycloneDDS.Runtime
 {
@@ -13,6 +15,8 @@ namespace CycloneDDS.Runtime
         private bool _disposed;
         
         private readonly Dictionary<string, DdsApi.DdsEntity> _topicCache = new();
+        // Topics created with RegisterManagedTopic (serdata built over managed buffers)
+        private readonly HashSet<string> _managedTopics = new();
         private readonly object _topicLock = new();
         // Track unmanaged resources for topics so we can free them on Dispose
         private readonly List<IDisposable> _topicResources = new();
@@ -84,6 +88,7 @@ namespace CycloneDDS.Runtime
                         DdsApi.dds_delete(topic);
                     }
                     _topicCache.Clear();
+                    _managedTopics.Clear();
 
                     // Free unmanaged resources
                     foreach (var resource in _topicResources)
@@ -145,6 +150,75 @@ namespace CycloneDDS.Runtime
             }
         }
 
+        /// <summary>
+        /// Registers a topic for type T backed by the managed sertype instead of a topic descriptor.
+        /// Writers on this topic hand their serialized buffer to Cyclone without a copy, and Cyclone
+        /// never interprets the CDR: instance keys come from the generated <c>ComputeKeyHash</c>.
+        /// Must be called before any writer or reader is created on the topic.
+        /// </summary>
+        /// <remarks>
+        /// Requires the patched ddsc (<c>dds_managed_sertype.c</c>). The topic carries no XTypes type
+        /// information, so it matches remote endpoints by type name only.
+        /// </remarks>
+        /// <exception cref="NotSupportedException">
+        /// The key of T has no generated key hash, or the loaded ddsc lacks the managed sertype exports.
+        /// </exception>
+        /// <exception cref="InvalidOperationException">The topic is already registered.</exception>
+        public void RegisterManagedTopic<T>(string topicName, IntPtr qos = default)
+        {
+            // Writers on the topic create their serdata through dds_managed_serdata_create
+            DdsApi.RequireExport(nameof(DdsApi.dds_create_topic_managed));
+            DdsApi.RequireExport(nameof(DdsApi.dds_managed_serdata_create));
+
+            if (!ManagedTypeSupport<T>.IsSupported)
+            {
+                throw new NotSupportedException(
+                    $"Type {typeof(T).Name} has key members without a generated key hash; use a descriptor-based topic.");
+            }
+
+            lock (_topicLock)
+            {
+                if (_disposed) throw new ObjectDisposedException(nameof(DdsParticipant));
+
+                if (_topicCache.ContainsKey(topicName))
+                {
+                    throw new InvalidOperationException($"Topic '{topicName}' is already registered.");
+                }
+
+                var callbacks = ManagedSertype.CreateCallbacks<T>();
+                var extensibility = typeof(T).GetCustomAttribute<DdsExtensibilityAttribute>()?.Kind ?? DdsExtensibilityKind.Appendable;
+                short representation = extensibility == DdsExtensibilityKind.Final
+                    ? DdsApi.DDS_DATA_REPRESENTATION_XCDR1
+                    : DdsApi.DDS_DATA_REPRESENTATION_XCDR2;
+
+                DdsApi.DdsEntity topic = DdsApi.dds_create_topic_managed(
+                    NativeEntity,
+                    topicName,
+                    DdsTypeSupport.GetTypeName<T>(),
+                    ManagedTypeSupport<T>.IsKeyed,
+                    representation,
+                    ref callbacks,
+                    qos);
+
+                if (!topic.IsValid)
+                {
+                    throw new DdsException(DdsApi.DdsReturnCode.Error,
+                        $"Failed to create managed topic '{topicName}' for type '{DdsTypeSupport.GetTypeName<T>()}'");
+                }
+
+                _topicCache[topicName] = topic;
+                _managedTopics.Add(topicName);
+            }
+        }
+
+        internal bool IsManagedTopic(string topicName)
+        {
+            lock (_topicLock)
+            {
+                return _managedTopics.Contains(topicName);
+            }
+        }
+
         [StructLayout(LayoutKind.Sequential)]
         private struct DdsTopicDescriptor
         {
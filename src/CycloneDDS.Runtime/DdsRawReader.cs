@@ -0,0 +1,322 @@
+using System;
+using System.Buffers;
+using System.Reflection;
+using System.Runtime.ExceptionServices;
+using System.Runtime.InteropServices;
+using System.Threading;
+using System.Threading.Tasks;
+using CycloneDDS.Runtime.Interop;
+using CycloneDDS.Schema;
+
+namespace CycloneDDS.Runtime
+{
+    /// <summary>
+    /// Non-generic reader that hands out the serialized form of samples (CDR including the
+    /// 4-byte encapsulation header) instead of deserializing them.
+    /// Intended for bridges, recorders and relays: pair it with <see cref="DdsWriter{T}.WriteRaw"/>
+    /// to forward a sample at the cost of roughly one memcpy.
+    /// </summary>
+    public sealed class DdsRawReader : IDisposable
+    {
+        private static readonly MethodInfo _createReaderMethod =
+            typeof(DdsRawReader).GetMethod(nameof(CreateReader), BindingFlags.NonPublic | BindingFlags.Static)!;
+
+        private DdsEntityHandle? _readerHandle;
+
+        // Async support (same scheme as DdsReader<T, TView>)
+        private IntPtr _listener = IntPtr.Zero;
+        private GCHandle _paramHandle;
+        private volatile TaskCompletionSource<bool>? _waitTaskSource;
+        private readonly DdsApi.DdsOnDataAvailable _dataAvailableHandler;
+        private readonly object _listenerLock = new object();
+
+        /// <summary>
+        /// Creates a raw reader on <paramref name="topicName"/>. <paramref name="topicType"/> is the
+        /// generated topic struct; it is only used to register the topic and pick the data representation.
+        /// </summary>
+        /// <exception cref="ArgumentException"><paramref name="topicType"/> is not a DDS topic struct.</exception>
+        public DdsRawReader(DdsParticipant participant, string topicName, Type topicType, IntPtr qos = default)
+        {
+            if (participant == null) throw new ArgumentNullException(nameof(participant));
+            _dataAvailableHandler = OnDataAvailable;
+            if (topicType == null || !topicType.IsValueType)
+            {
+                throw new ArgumentException($"Type '{topicType?.Name}' is not a DDS topic struct.", nameof(topicType));
+            }
+
+            DdsApi.DdsEntity reader = default;
+            try
+            {
+                reader = (DdsApi.DdsEntity)_createReaderMethod.MakeGenericMethod(topicType)
+                    .Invoke(null, new object[] { participant, topicName, qos })!;
+            }
+            catch (TargetInvocationException ex) when (ex.InnerException != null)
+            {
+                ExceptionDispatchInfo.Capture(ex.InnerException).Throw();
+            }
+
+            _readerHandle = new DdsEntityHandle(reader);
+        }
+
+        private static DdsApi.DdsEntity CreateReader<T>(DdsParticipant participant, string topicName, IntPtr qos)
+        {
+            IntPtr actualQos = qos;
+            bool ownQos = false;
+
+            if (actualQos == IntPtr.Zero)
+            {
+                actualQos = DdsApi.dds_create_qos();
+                ownQos = true;
+            }
+
+            try
+            {
+                var topic = participant.GetOrRegisterTopic<T>(topicName, actualQos);
+
+                // Same representation choice as DdsReader<T, TView>
+                var extensibility = typeof(T).GetCustomAttribute<DdsExtensibilityAttribute>()?.Kind ?? DdsExtensibilityKind.Appendable;
+                if (extensibility == DdsExtensibilityKind.Appendable || extensibility == DdsExtensibilityKind.Mutable)
+                {
+                    short[] reps = { DdsApi.DDS_DATA_REPRESENTATION_XCDR2 };
+                    DdsApi.dds_qset_data_representation(actualQos, (uint)reps.Length, reps);
+                }
+
+                var reader = DdsApi.dds_create_reader(participant.NativeEntity, topic, actualQos, IntPtr.Zero);
+                if (!reader.IsValid)
+                {
+                    throw new DdsException((DdsApi.DdsReturnCode)reader.Handle, $"Failed to create raw reader for '{topicName}'");
+                }
+                return reader;
+            }
+            finally
+            {
+                if (ownQos) DdsApi.dds_delete_qos(actualQos);
+            }
+        }
+
+        public RawSampleScope Take(int maxSamples = 32)
+        {
+            return ReadOrTake(maxSamples, true);
+        }
+
+        public RawSampleScope Read(int maxSamples = 32)
+        {
+            return ReadOrTake(maxSamples, false);
+        }
+
+        private RawSampleScope ReadOrTake(int maxSamples, bool isTake)
+        {
+            if (_readerHandle == null) throw new ObjectDisposedException(nameof(DdsRawReader));
+
+            var samples = ArrayPool<IntPtr>.Shared.Rent(maxSamples);
+            var infos = ArrayPool<DdsApi.DdsSampleInfo>.Shared.Rent(maxSamples);
+
+            Array.Clear(samples, 0, maxSamples);
+            Array.Clear(infos, 0, maxSamples);
+
+            int count = isTake
+                ? DdsApi.dds_takecdr(_readerHandle.NativeHandle.Handle, samples, (uint)maxSamples, infos, 0xFFFFFFFF)
+                : DdsApi.dds_readcdr(_readerHandle.NativeHandle.Handle, samples, (uint)maxSamples, infos, 0xFFFFFFFF);
+
+            if (count < 0)
+            {
+                ArrayPool<IntPtr>.Shared.Return(samples);
+                ArrayPool<DdsApi.DdsSampleInfo>.Shared.Return(infos);
+
+                if (count == (int)DdsApi.DdsReturnCode.NoData)
+                {
+                    return new RawSampleScope(null, null, 0);
+                }
+                throw new DdsException((DdsApi.DdsReturnCode)count, $"dds_{(isTake ? "take" : "read")}cdr failed: {count}");
+            }
+
+            return new RawSampleScope(samples, infos, count);
+        }
+
+        /// <summary>
+        /// Completes when samples are available (possibly already before the call).
+        /// </summary>
+        public async Task<bool> WaitDataAsync(CancellationToken cancellationToken = default)
+        {
+            if (_readerHandle == null) throw new ObjectDisposedException(nameof(DdsRawReader));
+
+            EnsureListenerAttached();
+
+            var tcs = _waitTaskSource;
+            if (tcs == null || tcs.Task.IsCompleted)
+            {
+                tcs = new TaskCompletionSource<bool>(TaskCreationOptions.RunContinuationsAsynchronously);
+                _waitTaskSource = tcs;
+            }
+
+            // Data that arrived before the listener was armed raises no callback
+            if (HasData()) return true;
+
+            using (cancellationToken.Register(() => tcs.TrySetCanceled()))
+            {
+                try
+                {
+                    return await tcs.Task.ConfigureAwait(false);
+                }
+                catch (TaskCanceledException)
+                {
+                    if (cancellationToken.IsCancellationRequested) throw;
+                    return true;
+                }
+            }
+        }
+
+        private bool HasData()
+        {
+            using var scope = Read(1);
+            return scope.Count > 0;
+        }
+
+        private void EnsureListenerAttached()
+        {
+            if (_listener != IntPtr.Zero) return;
+
+            lock (_listenerLock)
+            {
+                if (_listener != IntPtr.Zero) return;
+
+                _paramHandle = GCHandle.Alloc(this);
+                _listener = DdsApi.dds_create_listener(GCHandle.ToIntPtr(_paramHandle));
+                DdsApi.dds_lset_data_available(_listener, _dataAvailableHandler);
+
+                if (_readerHandle != null)
+                {
+                    DdsApi.dds_reader_set_listener(_readerHandle.NativeHandle, _listener);
+                }
+            }
+        }
+
+        private static void OnDataAvailable(int reader, IntPtr arg)
+        {
+            if (arg == IntPtr.Zero) return;
+            try
+            {
+                var handle = GCHandle.FromIntPtr(arg);
+                if (handle.IsAllocated && handle.Target is DdsRawReader self)
+                {
+                    self._waitTaskSource?.TrySetResult(true);
+                }
+            }
+            catch { }
+        }
+
+        public void Dispose()
+        {
+            if (_listener != IntPtr.Zero)
+            {
+                DdsApi.dds_delete_listener(_listener);
+                _listener = IntPtr.Zero;
+            }
+            if (_paramHandle.IsAllocated) _paramHandle.Free();
+
+            _readerHandle?.Dispose();
+            _readerHandle = null;
+        }
+    }
+
+    /// <summary>
+    /// Samples taken by a <see cref="DdsRawReader"/>. Holds the native serdata references until disposed.
+    /// </summary>
+    public ref struct RawSampleScope
+    {
+        private IntPtr[]? _samples;
+        private DdsApi.DdsSampleInfo[]? _infos;
+        private int _count;
+
+        internal RawSampleScope(IntPtr[]? samples, DdsApi.DdsSampleInfo[]? infos, int count)
+        {
+            _samples = samples;
+            _infos = infos;
+            _count = count;
+        }
+
+        public int Count => _count;
+
+        public ReadOnlySpan<DdsApi.DdsSampleInfo> Infos => _infos != null ? _infos.AsSpan(0, _count) : ReadOnlySpan<DdsApi.DdsSampleInfo>.Empty;
+
+        /// <summary>
+        /// Size of the serialized sample (header included); 0 for samples without valid data.
+        /// </summary>
+        public int GetSize(int index)
+        {
+            IntPtr serdata = GetSerdata(index);
+            return serdata == IntPtr.Zero ? 0 : (int)DdsApi.ddsi_serdata_size(serdata);
+        }
+
+        /// <summary>
+        /// The serialized sample, without copying. Valid until the scope is disposed.
+        /// Empty for samples without valid data (e.g. dispose notifications).
+        /// </summary>
+        public unsafe ReadOnlySpan<byte> GetCdr(int index)
+        {
+            IntPtr serdata = GetSerdata(index);
+            if (serdata == IntPtr.Zero) return ReadOnlySpan<byte>.Empty;
+
+            uint size = DdsApi.ddsi_serdata_size(serdata);
+            if (size == 0) return ReadOnlySpan<byte>.Empty;
+
+            // The scope keeps its own reference until Dispose, which keeps the buffer alive,
+            // so the reference taken by to_ser_ref can be dropped right away.
+            IntPtr reference = DdsApi.ddsi_serdata_to_ser_ref(serdata, UIntPtr.Zero, (UIntPtr)size, out var iov);
+            DdsApi.ddsi_serdata_to_ser_unref(reference, iov);
+
+            return new ReadOnlySpan<byte>((void*)iov.iov_base, (int)iov.iov_len);
+        }
+
+        /// <summary>
+        /// Copies the serialized sample into <paramref name="destination"/> and returns the number of bytes written.
+        /// </summary>
+        /// <exception cref="ArgumentException"><paramref name="destination"/> is smaller than <see cref="GetSize"/>.</exception>
+        public unsafe int CopyTo(int index, Span<byte> destination)
+        {
+            IntPtr serdata = GetSerdata(index);
+            if (serdata == IntPtr.Zero) return 0;
+
+            uint size = DdsApi.ddsi_serdata_size(serdata);
+            if (destination.Length < size)
+            {
+                throw new ArgumentException($"Destination too small: {destination.Length} < {size}.", nameof(destination));
+            }
+
+            fixed (byte* p = destination)
+            {
+                DdsApi.ddsi_serdata_to_ser(serdata, UIntPtr.Zero, (UIntPtr)size, (IntPtr)p);
+            }
+            return (int)size;
+        }
+
+        private IntPtr GetSerdata(int index)
+        {
+            if (index < 0 || index >= _count) throw new IndexOutOfRangeException();
+            if (_infos == null || _samples == null) throw new ObjectDisposedException(nameof(RawSampleScope));
+
+            return _infos[index].ValidData == 0 ? IntPtr.Zero : _samples[index];
+        }
+
+        public void Dispose()
+        {
+            if (_count > 0 && _samples != null)
+            {
+                for (int i = 0; i < _count; i++)
+                {
+                    if (_samples[i] != IntPtr.Zero)
+                    {
+                        DdsApi.ddsi_serdata_unref(_samples[i]);
+                    }
+                }
+            }
+
+            if (_samples != null) ArrayPool<IntPtr>.Shared.Return(_samples);
+            if (_infos != null) ArrayPool<DdsApi.DdsSampleInfo>.Shared.Return(_infos);
+
+            _count = 0;
+            _samples = null;
+            _infos = null;
+        }
+    }
+}
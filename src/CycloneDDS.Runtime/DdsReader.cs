@@ -4,6 +4,7 @@ using System.Reflection;
 using System.Reflection.Emit;
 using System.Runtime.InteropServices;
 using System.Threading;
+using System.Threading.Channels;
 using System.Threading.Tasks;
 using System.Collections.Generic;
 using System.Runtime.CompilerServices;
@@ -17,7 +18,13 @@ namespace CycloneDDS.Runtime
 {
     public delegate void DeserializeDelegate<TView>(ref CdrReader reader, out TView view);
 
-    public sealed class DdsReader<T, TView> : IDisposable 
+    /// <summary>
+    /// Inline sample handler (see <see cref="DdsReader{T, TView}.OnSamples"/>). Runs on the Cyclone delivery
+    /// thread; the scope is only valid for the duration of the call and is disposed by the reader.
+    /// </summary>
+    public delegate void SampleHandler<TView>(in ViewScope<TView> samples) where TView : struct;
+
+    public sealed class DdsReader<T, TView> : IDisposable, IDataAvailableTarget
         where TView : struct
     {
         // Add field for tracking
@@ -34,12 +41,22 @@ namespace CycloneDDS.Runtime
         private IntPtr _listener = IntPtr.Zero;
         private GCHandle _paramHandle;
         private volatile TaskCompletionSource<bool>? _waitTaskSource;
-        private readonly DdsApi.DdsOnDataAvailable _dataAvailableHandler;
         private readonly DdsApi.DdsOnSubscriptionMatched _subscriptionMatchedHandler;
         private readonly object _listenerLock = new object();
         
         // Filtering
         private volatile Predicate<TView>? _filter;
+
+        // Listener-fed channel (OpenChannel)
+        private volatile ListenerChannelReader<TView>? _channel;
+
+        // Inline handler (OnSamples)
+        private volatile SampleHandler<TView>? _inlineHandler;
+        private readonly object _inlineLock = new object();
+        private int _inlineTakeSize;
+        private Exception? _lastHandlerError;
+        private int _channelTakeSize;
+        private long _channelDropped;
         
         // Events
         private EventHandler<DdsApi.DdsSubscriptionMatchedStatus>? _subscriptionMatched;
@@ -74,6 +91,7 @@ namespace CycloneDDS.Runtime
         private delegate int GetSerializedSizeDelegate(in T sample, int currentAlignment, CdrEncoding encoding);
 
         private static readonly DeserializeDelegate<TView>? _deserializer;
+        private static readonly DeserializeDelegate<TView>? _keyDeserializer;
         private static readonly SerializeDelegate? _serializer;
         private static readonly GetSerializedSizeDelegate? _sizer;
         
@@ -101,6 +119,7 @@ namespace CycloneDDS.Runtime
 
             try { 
                 _deserializer = CreateDeserializerDelegate(); 
+                _keyDeserializer = CreateKeyDeserializerDelegate();
                 _sizer = CreateSizerDelegate();
                 _serializer = CreateSerializerDelegate(); 
                 
@@ -118,7 +137,6 @@ namespace CycloneDDS.Runtime
 
         public DdsReader(DdsParticipant participant, string topicName, IntPtr qos = default)
         {
-            _dataAvailableHandler = OnDataAvailable;
             _subscriptionMatchedHandler = OnSubscriptionMatched;
             
             if (_deserializer == null) 
@@ -306,7 +324,7 @@ namespace CycloneDDS.Runtime
                  
                  _paramHandle = GCHandle.Alloc(this);
                  _listener = DdsApi.dds_create_listener(GCHandle.ToIntPtr(_paramHandle));
-                 DdsApi.dds_lset_data_available(_listener, _dataAvailableHandler);
+                 DdsApi.dds_lset_data_available(_listener, DataAvailableListener.Callback);
                  DdsApi.dds_lset_subscription_matched(_listener, _subscriptionMatchedHandler);
                  
                  if (_readerHandle != null)
@@ -330,21 +348,199 @@ namespace CycloneDDS.Runtime
              catch { }
         }
 
-        private static void OnDataAvailable(int reader, IntPtr arg)
+        void IDataAvailableTarget.OnDataAvailable(int reader)
         {
-             if (arg == IntPtr.Zero) return;
              try
              {
-                 var handle = GCHandle.FromIntPtr(arg);
-                 if (handle.IsAllocated && handle.Target is DdsReader<T, TView> self)
-                 {
-                     self._waitTaskSource?.TrySetResult(true);
-                 }
+                 if (_inlineHandler != null) RunInlineHandler();
+                 else FillChannel();
              }
-             catch { }
+             catch (Exception ex)
+             {
+                 // Nothing may propagate into the listener thread; a failed take (or decode) ends the channel
+                 // with the error, since the samples it held are lost and later fills would likely fail too
+                 Volatile.Write(ref _lastHandlerError, ex);
+                 _channel?.Writer.TryComplete(ex);
+             }
+             _waitTaskSource?.TrySetResult(true);
+        }
+
+        /// <summary>
+        /// Runs <paramref name="handler"/> directly on the Cyclone delivery thread whenever data arrives, with a
+        /// <see cref="ViewScope{TView}"/> over the freshly taken samples: no thread hop, no queue, no copy.
+        /// Pass null to stop.
+        /// </summary>
+        /// <param name="maxSamplesPerTake">Upper bound on one native take; the handler is called until the cache is drained.</param>
+        /// <remarks>
+        /// <para>
+        /// The handler holds up delivery for every reader served by that thread, so it must not block, wait on locks
+        /// held elsewhere, or call back into DDS entities beyond this reader. Keep it to decoding and handing results on;
+        /// use <see cref="ViewScope{TView}.Retain"/> to keep samples past the call. Do not dispose the scope.
+        /// </para>
+        /// <para>
+        /// Samples already in the reader cache are delivered on the calling thread before this method returns.
+        /// Exceptions are caught and reported through <see cref="LastHandlerError"/>.
+        /// The inline handler owns the samples: do not combine it with <see cref="OpenChannel"/> or <c>Take</c>.
+        /// </para>
+        /// </remarks>
+        public void OnSamples(SampleHandler<TView>? handler, int maxSamplesPerTake = 64)
+        {
+            if (_readerHandle == null) throw new ObjectDisposedException(nameof(DdsReader<T, TView>));
+            if (maxSamplesPerTake <= 0) throw new ArgumentOutOfRangeException(nameof(maxSamplesPerTake));
+
+            lock (_listenerLock)
+            {
+                if (handler != null && _channel != null) throw new InvalidOperationException("A channel is open on this reader.");
+
+                _inlineTakeSize = maxSamplesPerTake;
+                _inlineHandler = handler;
+                if (handler == null) return;
+
+                EnsureListenerAttached();
+            }
+
+            RunInlineHandler();
+        }
+
+        /// <summary>
+        /// Last exception thrown by the <see cref="OnSamples"/> handler, or by the listener while taking samples
+        /// for it or for the channel opened by <see cref="OpenChannel"/>; null if none.
+        /// </summary>
+        public Exception? LastHandlerError => Volatile.Read(ref _lastHandlerError);
+
+        private void RunInlineHandler()
+        {
+            if (_inlineHandler == null) return;
+
+            // The listener and OnSamples may both drain; one at a time keeps sample order,
+            // also across a handler swap
+            lock (_inlineLock)
+            {
+                while (_readerHandle != null)
+                {
+                    var handler = _inlineHandler;
+                    if (handler == null) return;
+
+                    int limit = _inlineTakeSize;
+                    using var scope = Take(limit);
+                    if (scope.Count == 0) return;
+
+                    try
+                    {
+                        handler(in scope);
+                    }
+                    catch (Exception ex)
+                    {
+                        Volatile.Write(ref _lastHandlerError, ex);
+                    }
+
+                    if (scope.Count < limit) return;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Switches the reader to listener-fed delivery: every data-available callback takes and decodes
+        /// the new samples on the Cyclone listener thread and writes them into a bounded channel, so a
+        /// consumer awaiting <c>ReadAllAsync</c> wakes with the data already decoded, without the
+        /// <see cref="WaitDataAsync"/> wakeup plus take round trip.
+        /// </summary>
+        /// <param name="capacity">Channel capacity in samples.</param>
+        /// <param name="fullMode">
+        /// What the listener does when the channel is full. <see cref="BoundedChannelFullMode.Wait"/> never blocks
+        /// the listener: samples that do not fit stay in the reader cache (subject to its History QoS) and are
+        /// taken once the consumer has drained the channel. The drop modes take everything and let the channel drop.
+        /// </param>
+        /// <param name="maxSamplesPerTake">Upper bound on one native take.</param>
+        /// <remarks>
+        /// The reader filter applies; dispose/unregister notifications (no valid data) are not forwarded.
+        /// Once opened, the channel owns the samples: do not mix with <c>Take</c>/<c>StreamAsync</c>.
+        /// The channel completes when the reader is disposed, or with the error (also in <see cref="LastHandlerError"/>)
+        /// if taking or decoding samples on the listener thread fails.
+        /// </remarks>
+        public ChannelReader<TView> OpenChannel(int capacity = 1024, BoundedChannelFullMode fullMode = BoundedChannelFullMode.Wait, int maxSamplesPerTake = 64)
+        {
+            if (_readerHandle == null) throw new ObjectDisposedException(nameof(DdsReader<T, TView>));
+            if (capacity <= 0) throw new ArgumentOutOfRangeException(nameof(capacity));
+            if (maxSamplesPerTake <= 0) throw new ArgumentOutOfRangeException(nameof(maxSamplesPerTake));
+
+            lock (_listenerLock)
+            {
+                if (_channel != null) throw new InvalidOperationException("A channel is already open on this reader.");
+                if (_inlineHandler != null) throw new InvalidOperationException("An inline OnSamples handler is set on this reader.");
+
+                var options = new BoundedChannelOptions(capacity)
+                {
+                    FullMode = fullMode,
+                    SingleWriter = true, // writes are serialized by FillChannel
+                    SingleReader = false,
+                    AllowSynchronousContinuations = false,
+                };
+                var channel = Channel.CreateBounded<TView>(options, _ => Interlocked.Increment(ref _channelDropped));
+
+                _channelTakeSize = maxSamplesPerTake;
+                _channel = new ListenerChannelReader<TView>(channel, capacity, fullMode, FillChannel);
+                EnsureListenerAttached();
+            }
+
+            // Samples that arrived before the listener was attached
+            FillChannel();
+            return _channel;
+        }
+
+        /// <summary>
+        /// Samples the channel opened by <see cref="OpenChannel"/> dropped because it was full (drop modes only).
+        /// </summary>
+        public long ChannelDroppedCount => Interlocked.Read(ref _channelDropped);
+
+        // Runs on the listener thread, or on the consumer thread when draining a Wait-mode backlog
+        private void FillChannel()
+        {
+            var channel = _channel;
+            if (channel == null) return;
+
+            lock (channel)
+            {
+                while (_readerHandle != null)
+                {
+                    int limit = _channelTakeSize;
+                    if (channel.FullMode == BoundedChannelFullMode.Wait)
+                    {
+                        // Raise Backlog before sampling the room: a consumer draining concurrently either
+                        // sees the flag and refills, or drained before the sample and leaves room here
+                        channel.Backlog = true;
+                        Interlocked.MemoryBarrier();
+                        limit = Math.Min(limit, channel.Capacity - channel.Count);
+                        if (limit <= 0) return;
+                    }
+
+                    int count;
+                    using (var scope = Take(limit))
+                    {
+                        count = scope.Count;
+                        var infos = scope.Infos;
+                        var filter = _filter;
+                        for (int i = 0; i < count; i++)
+                        {
+                            if (infos[i].ValidData == 0) continue;
+
+                            TView item = scope[i];
+                            if (filter != null && !filter(item)) continue;
+
+                            channel.Writer.TryWrite(item);
+                        }
+                    }
+
+                    if (count < limit)
+                    {
+                        channel.Backlog = false;
+                        return;
+                    }
+                }
+            }
         }
 
-        private TView[] TakeBatch()
+        private TView[] TakeArray()
         {
             using var scope = Take();
             if (scope.Count == 0) return Array.Empty<TView>();
@@ -361,7 +557,7 @@ namespace CycloneDDS.Runtime
             while (!cancellationToken.IsCancellationRequested)
             {
                 // Check for data before waiting to handle pre-existing samples
-                var batch = TakeBatch();
+                var batch = TakeArray();
                 if (batch.Length > 0)
                 {
                     foreach (var item in batch) yield return item;
@@ -371,11 +567,69 @@ namespace CycloneDDS.Runtime
                 await WaitDataAsync(cancellationToken);
                 
                 // After wait, try take again
-                batch = TakeBatch();
+                batch = TakeArray();
                  foreach (var item in batch) yield return item;
             }
         }
 
+        /// <summary>
+        /// Takes up to <paramref name="maxSamples"/> samples into a pooled <see cref="SampleBatch{TView}"/>,
+        /// which, unlike a <see cref="ViewScope{TView}"/>, can be kept across awaits. The caller disposes it.
+        /// </summary>
+        public SampleBatch<TView> TakeBatch(int maxSamples = 32)
+        {
+            return ReadOrTakeBatch(maxSamples, 0xFFFFFFFF, true);
+        }
+
+        /// <inheritdoc cref="TakeBatch"/>
+        public SampleBatch<TView> ReadBatch(int maxSamples = 32)
+        {
+            return ReadOrTakeBatch(maxSamples, 0xFFFFFFFF, false);
+        }
+
+        private SampleBatch<TView> ReadOrTakeBatch(int maxSamples, uint mask, bool isTake)
+        {
+            if (_readerHandle == null) throw new ObjectDisposedException(nameof(DdsReader<T, TView>));
+            if (maxSamples <= 0) throw new ArgumentOutOfRangeException(nameof(maxSamples));
+
+            var batch = SampleBatch<TView>.Rent(maxSamples, _deserializer!);
+            int count = isTake
+                ? DdsApi.dds_takecdr(_readerHandle.NativeHandle.Handle, batch.SampleBuffer, (uint)maxSamples, batch.InfoBuffer, mask)
+                : DdsApi.dds_readcdr(_readerHandle.NativeHandle.Handle, batch.SampleBuffer, (uint)maxSamples, batch.InfoBuffer, mask);
+
+            if (count < 0)
+            {
+                if (count == (int)DdsApi.DdsReturnCode.NoData) return batch;
+
+                batch.Dispose();
+                throw new DdsException((DdsApi.DdsReturnCode)count, $"dds_{(isTake ? "take" : "read")}cdr failed: {count}");
+            }
+
+            batch.SetCount(count);
+            return batch;
+        }
+
+        /// <summary>
+        /// Yields non-empty batches of taken samples until cancelled. Each batch belongs to the consumer,
+        /// which must dispose it (possibly after passing it on to other stages).
+        /// </summary>
+        public async IAsyncEnumerable<SampleBatch<TView>> StreamBatchesAsync(int maxSamples = 32,
+            [EnumeratorCancellation] CancellationToken cancellationToken = default)
+        {
+            while (!cancellationToken.IsCancellationRequested)
+            {
+                var batch = TakeBatch(maxSamples);
+                if (batch.Count > 0)
+                {
+                    yield return batch;
+                    continue;
+                }
+
+                batch.Dispose();
+                await WaitDataAsync(cancellationToken);
+            }
+        }
+
         public void Dispose()
         {
             if (_listener != IntPtr.Zero)
@@ -394,6 +648,8 @@ namespace CycloneDDS.Runtime
             _readerHandle = null;
             _topicHandle = DdsApi.DdsEntity.Null;
             _participant = null;
+
+            _channel?.Writer.TryComplete();
         }
         
         public DdsInstanceHandle LookupInstance(in T keySample)
@@ -403,8 +659,14 @@ namespace CycloneDDS.Runtime
             // Use XCDR2 for lookup serdata creation
             CdrEncoding encoding = CdrEncoding.Xcdr2;
 
-            // Use _sizer to calculate size. Start at offset 4 for header
-            int size = _sizer!(keySample, 4, encoding);
+            // SDK_KEY: key-only serialization when the type has generated key methods
+            var keySerializer = DdsKeySerializer<T>.Serializer;
+            var keySizer = DdsKeySerializer<T>.Sizer;
+
+            // Start at offset 4 for header
+            int size = keySerializer != null && keySizer != null
+                ? keySizer(keySample, 4, encoding)
+                : _sizer!(keySample, 4, encoding);
             byte[] buffer = Arena.Rent(size + 4);
 
             try
@@ -417,7 +679,10 @@ namespace CycloneDDS.Runtime
                 else { cdr.WriteByte(0x00); cdr.WriteByte(_encodingKindBE); }
                 cdr.WriteByte(0x00); cdr.WriteByte(0x00);
 
-                _serializer!(keySample, ref cdr);
+                if (keySerializer != null)
+                    keySerializer(keySample, ref cdr);
+                else
+                    _serializer!(keySample, ref cdr);
                 
                 unsafe
                 {
@@ -457,7 +722,7 @@ namespace CycloneDDS.Runtime
             return ReadOrTakeInstance(handle, maxSamples, 0xFFFFFFFF, false);
         }
 
-        private ViewScope<TView> ReadOrTakeInstance(DdsInstanceHandle handle, int maxSamples, uint mask, bool isTake)
+        private ViewScope<TView> ReadOrTakeInstance(DdsInstanceHandle handle, int maxSamples, uint mask, bool isTake, bool throwIfUnknown = true)
         {
              if (_readerHandle == null) throw new ObjectDisposedException(nameof(DdsReader<T, TView>));
              
@@ -495,7 +760,10 @@ namespace CycloneDDS.Runtime
                  ArrayPool<DdsApi.DdsSampleInfo>.Shared.Return(infos);
                  
                  if (count == (int)DdsApi.DdsReturnCode.BadParameter)
-                     throw new ArgumentException("Invalid instance handle");
+                 {
+                     if (throwIfUnknown) throw new ArgumentException("Invalid instance handle");
+                     return new ViewScope<TView>(_readerHandle.NativeHandle, null, null, 0, null, _filter, _registry);
+                 }
                  
                  // Handle NoData or other errors by returning empty view
                  // If it's pure error we might want to throw, but standard Read returns empty on NoData
@@ -508,6 +776,179 @@ namespace CycloneDDS.Runtime
              return new ViewScope<TView>(_readerHandle.NativeHandle, samples, infos, count, _deserializer, _filter, _registry);
         }
 
+        /// <summary>
+        /// Reads the samples of the first instance after <paramref name="previous"/> that has any
+        /// (<see cref="DdsInstanceHandle.Nil"/> starts at the beginning). Instances are visited in
+        /// ascending handle order, which is stable but unrelated to the key values.
+        /// An empty scope means there is no further instance.
+        /// </summary>
+        /// <remarks>
+        /// Each call scans the instance table under the reader cache lock. To visit every instance, list them once with
+        /// <see cref="GetInstances"/> and read each with <see cref="ReadInstance"/>.
+        /// </remarks>
+        /// <exception cref="NotSupportedException">The loaded ddsc lacks <c>dds_reader_next_instance</c>.</exception>
+        public ViewScope<TView> ReadNextInstance(DdsInstanceHandle previous, int maxSamples = 32)
+        {
+            return ReadOrTakeNextInstance(previous, maxSamples, false);
+        }
+
+        /// <inheritdoc cref="ReadNextInstance"/>
+        public ViewScope<TView> TakeNextInstance(DdsInstanceHandle previous, int maxSamples = 32)
+        {
+            return ReadOrTakeNextInstance(previous, maxSamples, true);
+        }
+
+        private ViewScope<TView> ReadOrTakeNextInstance(DdsInstanceHandle previous, int maxSamples, bool isTake)
+        {
+            long handle = previous.Value;
+            while (true)
+            {
+                handle = NextInstance(handle, (uint)DdsInstanceState.AnyInstanceState, out _, out IntPtr _, wantKey: false);
+                if (handle == 0)
+                {
+                    return new ViewScope<TView>(_readerHandle!.NativeHandle, null, null, 0, null, _filter, _registry);
+                }
+
+                // The instance may have been taken or purged since it was listed; move on to the next one
+                var scope = ReadOrTakeInstance(handle, maxSamples, 0xFFFFFFFF, isTake, throwIfUnknown: false);
+                if (scope.Count > 0) return scope;
+                scope.Dispose();
+            }
+        }
+
+        /// <summary>
+        /// Enumerates the instances in the reader cache, in batches of up to <paramref name="batchSize"/>,
+        /// with their handle, key and instance state, in ascending handle order. Keys come from the key-only
+        /// serdata kept per instance, so sample payloads are neither copied nor deserialized and sample states are unchanged.
+        /// </summary>
+        /// <remarks>
+        /// Each batch is one pass over the reader cache resuming after the last handle of the previous batch,
+        /// so only one batch is held at a time and instances created meanwhile are listed if their handle is
+        /// still ahead; instances whose samples have all been taken are listed too. Topics registered with
+        /// <see cref="DdsParticipant.RegisterManagedTopic{T}"/> keep the key-only CDR with each instance for this;
+        /// a key known only by its hash (an instance first seen through a key-hash-only dispose), and the key of a
+        /// keyless topic, is default.
+        /// </remarks>
+        /// <param name="batchSize">Maximum number of entries per yielded batch.</param>
+        /// <param name="instanceStates">Instance states to list; alive instances by default.</param>
+        /// <exception cref="NotSupportedException">The loaded ddsc lacks <c>dds_reader_collect_instances</c>.</exception>
+        public IEnumerable<DdsInstanceInfo<TView>[]> GetInstances(int batchSize = 256, DdsInstanceState instanceStates = DdsInstanceState.Alive)
+        {
+            if (batchSize <= 0) throw new ArgumentOutOfRangeException(nameof(batchSize));
+            if (_readerHandle == null) throw new ObjectDisposedException(nameof(DdsReader<T, TView>));
+
+            // Checked here rather than on the first MoveNext, so a missing export surfaces at the call
+            DdsApi.RequireExport(nameof(DdsApi.dds_reader_collect_instances));
+
+            return EnumerateInstances(batchSize, (uint)instanceStates);
+        }
+
+        private IEnumerable<DdsInstanceInfo<TView>[]> EnumerateInstances(int batchSize, uint instanceStates)
+        {
+            // Scratch for the native call, reused across batches; only the yielded batch is allocated
+            var handles = new ulong[batchSize];
+            var states = new uint[batchSize];
+            var keys = new IntPtr[batchSize];
+
+            ulong after = 0;
+            while (true)
+            {
+                var batch = CollectInstances(instanceStates, after, handles, states, keys);
+                if (batch.Length > 0) yield return batch;
+                if (batch.Length < batchSize) yield break;
+                after = handles[batchSize - 1];
+            }
+        }
+
+        private unsafe DdsInstanceInfo<TView>[] CollectInstances(uint instanceStates, ulong after, ulong[] handles, uint[] states, IntPtr[] keys)
+        {
+            if (_readerHandle == null) throw new ObjectDisposedException(nameof(DdsReader<T, TView>));
+
+            int count;
+            fixed (ulong* h = handles)
+            fixed (uint* st = states)
+            fixed (IntPtr* k = keys)
+            {
+                count = DdsApi.dds_reader_collect_instances(
+                    _readerHandle.NativeHandle.Handle, instanceStates, after, (uint)handles.Length, h, st, k);
+            }
+            if (count < 0) throw new DdsException((DdsApi.DdsReturnCode)count, $"dds_reader_collect_instances failed: {count}");
+            if (count == 0) return Array.Empty<DdsInstanceInfo<TView>>();
+
+            var result = new DdsInstanceInfo<TView>[count];
+            try
+            {
+                for (int i = 0; i < count; i++)
+                {
+                    result[i] = new DdsInstanceInfo<TView>((long)handles[i], DecodeInstanceKey(keys[i]), (DdsInstanceState)states[i]);
+                }
+            }
+            finally
+            {
+                ReleaseSerdata(keys, count);
+            }
+            return result;
+        }
+
+        private static void ReleaseSerdata(IntPtr[] serdata, int count)
+        {
+            for (int i = 0; i < count; i++)
+            {
+                if (serdata[i] != IntPtr.Zero) DdsApi.ddsi_serdata_unref(serdata[i]);
+            }
+        }
+
+        private unsafe long NextInstance(long previous, uint instanceStates, out DdsInstanceState state, out IntPtr key, bool wantKey)
+        {
+            if (_readerHandle == null) throw new ObjectDisposedException(nameof(DdsReader<T, TView>));
+            DdsApi.RequireExport(nameof(DdsApi.dds_reader_next_instance));
+
+            uint nativeState = 0;
+            IntPtr nativeKey = IntPtr.Zero;
+            long next = DdsApi.dds_reader_next_instance(
+                _readerHandle.NativeHandle.Handle, previous, instanceStates, &nativeState, wantKey ? &nativeKey : null);
+
+            state = (DdsInstanceState)nativeState;
+            key = nativeKey;
+            return next;
+        }
+
+        // Default for keyless topics and for key serdata holding only the key hash
+        private static TView DecodeInstanceKey(IntPtr keySerdata)
+        {
+            return _keyDeserializer != null && keySerdata != IntPtr.Zero && TryDecode(_keyDeserializer, keySerdata, out TView key)
+                ? key
+                : default;
+        }
+
+        // Header handling as in ViewScope's indexer; false when the serdata carries no payload
+        private static unsafe bool TryDecode(DeserializeDelegate<TView> deserializer, IntPtr serdata, out TView view)
+        {
+            view = default;
+            uint size = DdsApi.ddsi_serdata_size(serdata);
+            if (size <= 4) return false;
+
+            byte[] buffer = Arena.Rent((int)size);
+            try
+            {
+                fixed (byte* p = buffer)
+                {
+                    DdsApi.ddsi_serdata_to_ser(serdata, UIntPtr.Zero, (UIntPtr)size, (IntPtr)p);
+
+                    CdrEncoding encoding = p[1] >= 6 ? CdrEncoding.Xcdr2 : CdrEncoding.Xcdr1;
+                    int origin = encoding == CdrEncoding.Xcdr2 ? 0 : 4;
+                    var reader = new CdrReader(new ReadOnlySpan<byte>(p, (int)size), encoding, origin: origin);
+                    reader.ReadInt32(); // Encapsulation header
+                    deserializer(ref reader, out view);
+                    return true;
+                }
+            }
+            finally
+            {
+                Arena.Return(buffer);
+            }
+        }
+
         /// <summary>
         /// Enable sender tracking for this reader.
         /// After this, ViewScope.GetSender(index) will return sender information.
@@ -600,6 +1041,57 @@ namespace CycloneDDS.Runtime
             return default;
         }
 
+        /// <summary>
+        /// Forces static initialization and JIT of the decode path and round-trips
+        /// a synthetic sample (see <see cref="DdsTypeSupport.CreateSample{T}"/>) through it once.
+        /// </summary>
+        internal static void Prewarm()
+        {
+            if (_deserializer == null || _sizer == null || _serializer == null)
+            {
+                throw new InvalidOperationException($"Type {typeof(T).Name} missing Deserialize method.");
+            }
+
+            DdsTypeSupport.PrepareGeneratedMethod(typeof(T), "Deserialize", typeof(CdrReader).MakeByRefType());
+            var indexer = typeof(ViewScope<TView>).GetProperty("Item")?.GetMethod;
+            if (indexer != null)
+            {
+                RuntimeHelpers.PrepareMethod(indexer.MethodHandle, new[] { typeof(TView).TypeHandle });
+            }
+
+            var attr = typeof(T).GetCustomAttribute<DdsExtensibilityAttribute>();
+            CdrEncoding encoding = attr?.Kind == DdsExtensibilityKind.Final ? CdrEncoding.Xcdr1 : CdrEncoding.Xcdr2;
+            int origin = encoding == CdrEncoding.Xcdr2 ? 0 : 4;
+            T sample = DdsTypeSupport.CreateSample<T>();
+
+            int totalSize = _sizer(sample, 4 + origin, encoding) + 4;
+            byte[] buffer = Arena.Rent(totalSize);
+            try
+            {
+                var span = buffer.AsSpan(0, totalSize);
+                var cdr = new CdrWriter(span, encoding, origin: origin);
+                DdsWriter<T>.WriteEncapsulationHeader(ref cdr, encoding);
+                _serializer(sample, ref cdr);
+                cdr.Complete();
+
+                var reader = new CdrReader(span.Slice(0, cdr.Position), encoding, origin: origin);
+                reader.ReadInt32(); // Encapsulation header
+                _deserializer(ref reader, out TView _);
+            }
+            finally
+            {
+                Arena.Return(buffer);
+            }
+
+            Volatile.Write(ref _prewarmed, true);
+        }
+
+        /// <summary>
+        /// True once <see cref="Prewarm"/> has round-tripped a sample through the decode path.
+        /// </summary>
+        internal static bool IsPrewarmed => Volatile.Read(ref _prewarmed);
+
+        private static bool _prewarmed;
 
         private static GetSerializedSizeDelegate CreateSizerDelegate()
         {
@@ -651,6 +1143,23 @@ namespace CycloneDDS.Runtime
             return (SerializeDelegate)dm.CreateDelegate(typeof(SerializeDelegate));
         }
 
+        // Generated for keyed types only; null otherwise
+        private static DeserializeDelegate<TView>? CreateKeyDeserializerDelegate()
+        {
+             var method = typeof(T).GetMethod("DeserializeKey", BindingFlags.Public | BindingFlags.Static, new[] { typeof(CdrReader).MakeByRefType() });
+             if (method == null || method.ReturnType != typeof(TView)) return null;
+
+             var dm = new DynamicMethod("DeserializeKeyThunk", typeof(void), new[] { typeof(CdrReader).MakeByRefType(), typeof(TView).MakeByRefType() }, typeof(DdsReader<T,TView>).Module);
+             var il = dm.GetILGenerator();
+             il.Emit(OpCodes.Ldarg_1); // out view
+             il.Emit(OpCodes.Ldarg_0); // ref reader
+             il.Emit(OpCodes.Call, method);
+             il.Emit(OpCodes.Stobj, typeof(TView));
+             il.Emit(OpCodes.Ret);
+
+             return (DeserializeDelegate<TView>)dm.CreateDelegate(typeof(DeserializeDelegate<TView>));
+        }
+
         private static DeserializeDelegate<TView> CreateDeserializerDelegate()
         {
              var method = typeof(T).GetMethod("Deserialize", new[] { typeof(CdrReader).MakeByRefType() });
@@ -724,24 +1233,34 @@ namespace CycloneDDS.Runtime
             uint size = DdsApi.ddsi_serdata_size(serdata);
             if (size == 0) return Array.Empty<byte>();
 
-            // FIX: Allocate extra padding to prevent AccessViolation if native writes alignment bytes
-            byte[] buffer = new byte[size + 4096]; 
+            // to_ser copies exactly 'size' bytes, so one exact-size buffer is enough
+            byte[] result = new byte[size];
             
             unsafe
             {
-                fixed (byte* p = buffer)
+                fixed (byte* p = result)
                 {
-                    // This copies data into 'buffer'
                     DdsApi.ddsi_serdata_to_ser(serdata, UIntPtr.Zero, (UIntPtr)size, (IntPtr)p);
                 }
             }
 
-            // Return only the valid data part
-            byte[] result = new byte[size];
-            Array.Copy(buffer, result, size);
             return result;
         }
 
+        /// <summary>
+        /// Keeps the sample at <paramref name="index"/> alive after this scope is disposed, by taking
+        /// one more reference to its serdata. Nothing is copied; the caller disposes the result.
+        /// </summary>
+        public RetainedSample<TView> Retain(int index)
+        {
+            if (index < 0 || index >= _count) throw new IndexOutOfRangeException();
+            if (_infos == null || _samples == null) throw new ObjectDisposedException("ViewScope");
+
+            IntPtr serdata = _samples[index];
+            if (serdata != IntPtr.Zero) DdsApi.ddsi_serdata_ref(serdata);
+            return new RetainedSample<TView>(serdata, _infos[index], _deserializer!);
+        }
+
         public int Count => _count;
 
         public Enumerator GetEnumerator() => new Enumerator(this, _filter);
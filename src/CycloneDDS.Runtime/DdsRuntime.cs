@@ -0,0 +1,141 @@
+using System;
+using System.Buffers;
+using System.Collections.Concurrent;
+using System.Reflection;
+using System.Runtime.ExceptionServices;
+using System.Runtime.InteropServices;
+using CycloneDDS.Runtime.Interop;
+using CycloneDDS.Runtime.Memory;
+
+namespace CycloneDDS.Runtime
+{
+    /// <summary>
+    /// Process-wide runtime helpers.
+    /// </summary>
+    public static class DdsRuntime
+    {
+        private static readonly ConcurrentDictionary<Type, bool> _prewarmed = new();
+        private static readonly MethodInfo _prewarmMethod =
+            typeof(DdsRuntime).GetMethod(nameof(Prewarm), BindingFlags.Public | BindingFlags.Static, null, Type.EmptyTypes, null)!;
+
+        // Native entry points on the write/take hot paths
+        private static readonly string[] _hotPathImports =
+        {
+            nameof(DdsApi.dds_get_topic_sertype),
+            nameof(DdsApi.ddsi_serdata_from_ser_iov),
+            nameof(DdsApi.dds_writecdr),
+            nameof(DdsApi.dds_takecdr),
+            nameof(DdsApi.dds_readcdr),
+            nameof(DdsApi.ddsi_serdata_size),
+            nameof(DdsApi.ddsi_serdata_to_ser),
+            nameof(DdsApi.ddsi_serdata_unref),
+        };
+
+        private static int _importsPrelinked;
+
+        /// <summary>
+        /// Moves the one-time costs of a topic type out of the first write/take.
+        /// </summary>
+        /// <remarks>
+        /// Runs the static constructors of <see cref="DdsWriter{T}"/> and <see cref="DdsReader{T, TView}"/>
+        /// (reflection and DynamicMethod thunks), JIT-compiles the generated serializer methods,
+        /// performs a size/serialize/deserialize round trip of a synthetic sample with all managed members set,
+        /// resolves the native hot-path entry points and primes the arena buffers.
+        /// Readers are prewarmed for the <c>DdsReader&lt;T, T&gt;</c> view; other view types
+        /// still pay for their own delegate compilation.
+        /// Calling it more than once per type is a no-op.
+        /// </remarks>
+        public static void Prewarm<T>() where T : struct
+        {
+            if (!_prewarmed.TryAdd(typeof(T), true)) return;
+
+            PrelinkHotPathImports();
+
+            // Descriptor reflection used by GetOrRegisterTopic
+            DdsTypeSupport.GetDescriptorOps<T>();
+            DdsTypeSupport.GetKeyDescriptors<T>();
+            DdsTypeSupport.GetTypeName<T>();
+
+            int size = DdsWriter<T>.Prewarm();
+            DdsReader<T, T>.Prewarm();
+
+            PrimeArena(size);
+        }
+
+        /// <summary>
+        /// Prewarms type <typeparamref name="T"/> and registers its topic on the participant,
+        /// so descriptor marshalling and native topic creation also happen ahead of time.
+        /// </summary>
+        public static void Prewarm<T>(DdsParticipant participant, string topicName) where T : struct
+        {
+            if (participant == null) throw new ArgumentNullException(nameof(participant));
+
+            Prewarm<T>();
+            participant.GetOrRegisterTopic<T>(topicName);
+        }
+
+        /// <summary>
+        /// Prewarms several topic types at once. See <see cref="Prewarm{T}()"/>.
+        /// </summary>
+        /// <exception cref="ArgumentException">A type is not a generated DDS struct.</exception>
+        public static void Prewarm(params Type[] types)
+        {
+            if (types == null) throw new ArgumentNullException(nameof(types));
+
+            foreach (var type in types)
+            {
+                if (type == null || !type.IsValueType)
+                {
+                    throw new ArgumentException($"Type '{type?.Name}' is not a DDS topic struct.", nameof(types));
+                }
+
+                try
+                {
+                    _prewarmMethod.MakeGenericMethod(type).Invoke(null, null);
+                }
+                catch (TargetInvocationException ex) when (ex.InnerException != null)
+                {
+                    ExceptionDispatchInfo.Capture(ex.InnerException).Throw();
+                }
+            }
+        }
+
+        /// <summary>
+        /// Received samples of managed-sertype topics dropped because their key hash could not be
+        /// computed (malformed CDR). Counted instead of logged: the callback runs on the delivery path.
+        /// </summary>
+        public static long ManagedKeyHashFailures => ManagedSertype.KeyHashFailures;
+
+        private static void PrelinkHotPathImports()
+        {
+            if (System.Threading.Interlocked.Exchange(ref _importsPrelinked, 1) != 0) return;
+
+            foreach (var name in _hotPathImports)
+            {
+                foreach (var method in typeof(DdsApi).GetMethods(BindingFlags.Public | BindingFlags.Static))
+                {
+                    if (method.Name == name && (method.Attributes & MethodAttributes.PinvokeImpl) != 0)
+                    {
+                        Marshal.Prelink(method);
+                    }
+                }
+            }
+        }
+
+        private static void PrimeArena(int size)
+        {
+            // Rent two and return both: the first return fills the calling thread's slot,
+            // the second lands in the shared per-core stacks other threads can rent from.
+            int length = Math.Max(size, 256);
+            byte[] first = Arena.Rent(length);
+            byte[] second = Arena.Rent(length);
+            Arena.Return(first);
+            Arena.Return(second);
+
+            var samples = ArrayPool<IntPtr>.Shared.Rent(32);
+            var infos = ArrayPool<DdsApi.DdsSampleInfo>.Shared.Rent(32);
+            ArrayPool<IntPtr>.Shared.Return(samples);
+            ArrayPool<DdsApi.DdsSampleInfo>.Shared.Return(infos);
+        }
+    }
+}
@@ -1,6 +1,8 @@
 using System;
 using System.Collections.Concurrent;
 using System.Reflection;
+using System.Runtime.CompilerServices;
+using CycloneDDS.Schema;
 
 namespace CycloneDDS.Runtime
 {
@@ -76,5 +78,55 @@ namespace CycloneDDS.Runtime
                 return typeof(T).Name;
             return name.Replace(".", "::");
         }
+
+        /// <summary>
+        /// A sample that the generated serializers accept: <c>default(T)</c> with every managed member
+        /// set (empty strings and collections, fixed arrays at their declared length, nested structs filled in).
+        /// Optional (nullable) members stay absent.
+        /// </summary>
+        internal static T CreateSample<T>()
+        {
+            return (T)CreateValue(typeof(T), depth: 0, arrayLength: 0)!;
+        }
+
+        private static object? CreateValue(Type type, int depth, int arrayLength)
+        {
+            if (type == typeof(string)) return string.Empty;
+            if (type.IsArray) return Array.CreateInstance(type.GetElementType()!, arrayLength);
+            if (type.IsPrimitive || type.IsEnum || Nullable.GetUnderlyingType(type) != null) return type.IsValueType ? Activator.CreateInstance(type) : null;
+
+            // Recursive (optional) references end here
+            if (depth > 16) return type.IsValueType ? Activator.CreateInstance(type) : null;
+
+            if (!type.IsValueType)
+            {
+                if (type.IsAbstract || type.GetConstructor(Type.EmptyTypes) == null) return null;
+                if (type.IsGenericType) return Activator.CreateInstance(type); // List<T> and friends start empty
+            }
+
+            object instance = Activator.CreateInstance(type)!;
+            foreach (var field in type.GetFields(BindingFlags.Public | BindingFlags.Instance))
+            {
+                if (field.IsInitOnly || field.FieldType.IsPrimitive || field.FieldType.IsEnum) continue;
+                if (!field.FieldType.IsValueType && field.GetValue(instance) != null) continue;
+
+                int length = field.GetCustomAttribute<ArrayLengthAttribute>()?.Length ?? 0;
+                field.SetValue(instance, CreateValue(field.FieldType, depth + 1, length));
+            }
+            return instance;
+        }
+
+        /// <summary>
+        /// JIT-compile a generated method of a topic type ahead of its first call.
+        /// Missing methods are ignored (not every type has every generated method).
+        /// </summary>
+        public static void PrepareGeneratedMethod(Type type, string name, params Type[] parameterTypes)
+        {
+            var method = type.GetMethod(name, BindingFlags.Public | BindingFlags.Instance | BindingFlags.Static, null, parameterTypes, null);
+            if (method != null && !method.ContainsGenericParameters)
+            {
+                RuntimeHelpers.PrepareMethod(method.MethodHandle);
+            }
+        }
     }
 }
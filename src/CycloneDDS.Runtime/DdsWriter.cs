@@ -1,4 +1,5 @@
 using System;
+using System.Collections.Generic;
 using System.Linq;
 using System.Reflection;
 using System.Reflection.Emit;
@@ -27,8 +28,24 @@ namespace CycloneDDS.Runtime
 
         private DdsEntityHandle? _writerHandle;
         private DdsApi.DdsEntity _topicHandle;
+        private IntPtr _sertype;
         private DdsParticipant? _participant;
         private readonly string _topicName;
+        private readonly bool _managedSertype;
+        private volatile bool _trustedProducer;
+        private volatile WriterPacing? _pacing;
+        private AckWaiter? _ackWaiter;
+
+        // WriteIfChanged: last CDR per instance (key hash -> arena buffer). Any other write,
+        // dispose or unregister bumps the generation, which drops the whole cache.
+        private Dictionary<(ulong, ulong), (byte[] Buffer, int Length)>? _lastWritten;
+        private readonly object _lastWrittenLock = new object();
+        private int _writeGeneration;
+        private int _lastWrittenGeneration;
+
+        // Per registered instance: the key serdata and the native instance entry, one ref each
+        private readonly Dictionary<long, RegisteredInstance> _registeredInstances = new();
+        private readonly object _instanceLock = new object();
 
         // Async/Events
         private IntPtr _listener = IntPtr.Zero;
@@ -43,8 +60,20 @@ namespace CycloneDDS.Runtime
         private delegate int GetSerializedSizeDelegate(in T sample, int currentAlignment, CdrEncoding encoding);
 
         private static readonly SerializeDelegate? _serializer;
-        private static readonly SerializeDelegate? _keySerializer;
+        private static readonly DdsKeySerializer<T>.SerializeKeyDelegate? _keySerializer = DdsKeySerializer<T>.Serializer;
+        private static readonly DdsKeySerializer<T>.GetKeySerializedSizeDelegate? _keySizer = DdsKeySerializer<T>.Sizer;
+        private static readonly DdsKeySerializer<T>.ComputeKeyHashDelegate? _keyHasher = DdsKeySerializer<T>.KeyHasher;
         private static readonly GetSerializedSizeDelegate? _sizer;
+
+        // Precomputed key hash goes with every serdata when both the type and the native library support it
+        private static readonly bool _attachKeyHash =
+            _keyHasher != null && DdsApi.HasExport(nameof(DdsApi.dds_serdata_from_ser_iov_keyhash));
+
+        // Write(in T, DdsInstanceHandle): write to a cached instance entry, no key lookup
+        private static readonly bool _writesByInstance = DdsApi.HasExport(nameof(DdsApi.dds_write_serdata_tk));
+
+        // SerializedSample: stamp once in Serialize, publish with dds_forwardcdr
+        internal static readonly bool StampsSharedSamples = DdsApi.HasExport(nameof(DdsApi.dds_serdata_set_source_timestamp));
         private static readonly DdsExtensibilityKind _extensibilityKind;
 
         static DdsWriter()
@@ -73,7 +102,6 @@ namespace CycloneDDS.Runtime
             {
                 _sizer = CreateSizerDelegate();
                 _serializer = CreateSerializerDelegate();
-                _keySerializer = CreateKeySerializerDelegate();
             }
             catch (Exception ex)
             {
@@ -112,6 +140,8 @@ namespace CycloneDDS.Runtime
 
                 // 1. Get or register topic (auto-discovery) - Use modified QoS
                 _topicHandle = participant.GetOrRegisterTopic<T>(topicName, actualQos);
+                _managedSertype = participant.IsManagedTopic(topicName);
+                _sertype = DdsApi.dds_get_topic_sertype(_topicHandle);
 
                 DdsApi.DdsEntity writer = default;
 
@@ -158,6 +188,7 @@ namespace CycloneDDS.Runtime
         public void WriteViaDdsWrite(in T sample)
         {
              if (_writerHandle == null) throw new ObjectDisposedException(nameof(DdsWriter<T>));
+             InvalidateLastWritten();
              #pragma warning disable CS8500 // This takes the address of, gets the size of, or declares a pointer to a managed type ('T')
              unsafe
              {
@@ -170,105 +201,356 @@ namespace CycloneDDS.Runtime
              #pragma warning restore CS8500
         }
 
-        private void PerformOperation(in T sample, Func<DdsApi.DdsEntity, IntPtr, int> operation, int serdataKind = 2)
+        private void PerformOperation(in T sample, Func<DdsApi.DdsEntity, IntPtr, int> operation, int serdataKind = 2, int serializedSize = -1)
         {
-            if (_writerHandle == null) throw new ObjectDisposedException(nameof(DdsWriter<T>));
-            if (!_topicHandle.IsValid) throw new ObjectDisposedException(nameof(DdsWriter<T>));
+            InvalidateLastWritten();
+
+            IntPtr serdata = CreateSerdata(sample, serdataKind, serializedSize);
+            if (serdata == IntPtr.Zero)
+            {
+                 throw new DdsException(DdsApi.DdsReturnCode.Error, "dds_create_serdata_from_cdr failed");
+            }
+
+            // Operation consumes ref
+            int ret = operation(_writerHandle!.NativeHandle, serdata);
+            if (ret < 0)
+            {
+                throw new DdsException((DdsApi.DdsReturnCode)ret, $"DDS operation failed: {ret}");
+            }
+        }
 
+        /// <summary>
+        /// Size of the CDR buffer (header included) the writer builds for the sample.
+        /// For SDK_KEY only the key is serialized when the type has generated key methods.
+        /// </summary>
+        internal int GetSerializedBufferSize(in T sample, int serdataKind)
+        {
             // FIX: XCDR2 alignment is relative to stream start (0).
             // XCDR1 alignment is relative to body start (after 4-byte header) -> origin 4.
             int origin = _encoding == CdrEncoding.Xcdr2 ? 0 : 4;
 
-            // 1. Get Size (no alloc)
             // Start at offset 4 (Header) + origin to ensure padding is calculated correctly
             int startPos = 4 + origin;
-            int payloadSize = _sizer!(sample, startPos, _encoding); 
-            int totalSize = payloadSize + 4;
+            int payloadSize = serdataKind == 1 && _keySerializer != null && _keySizer != null
+                ? _keySizer(sample, startPos, _encoding)
+                : _sizer!(sample, startPos, _encoding);
+            return payloadSize + 4;
+        }
+
+        /// <summary>
+        /// Serializes the sample (or only its key for SDK_KEY) and returns a new serdata holding
+        /// one reference, or <see cref="IntPtr.Zero"/> if native serdata creation failed.
+        /// <paramref name="serializedSize"/> is <see cref="GetSerializedBufferSize"/> when the caller already
+        /// computed it (pacing), or -1. Without <paramref name="keyHash"/> the precomputed key hash is
+        /// left out (the instance is known); managed-sertype serdata always carries it.
+        /// </summary>
+        private IntPtr CreateSerdata(in T sample, int serdataKind, int serializedSize = -1, bool keyHash = true)
+        {
+            if (_writerHandle == null) throw new ObjectDisposedException(nameof(DdsWriter<T>));
+            if (!_topicHandle.IsValid) throw new ObjectDisposedException(nameof(DdsWriter<T>));
+
+            // 1. Get Size (no alloc)
+            int totalSize = serializedSize >= 0 ? serializedSize : GetSerializedBufferSize(sample, serdataKind);
 
             // 2. Rent Buffer (no alloc - pooled)
             byte[] buffer = Arena.Rent(totalSize);
+            bool bufferOwnedBySerdata = false;
             
             try
             {
                 // 3. Serialize (ZERO ALLOC via new Span overload)
-                var span = buffer.AsSpan(0, totalSize);
-                var cdr = new CdrWriter(span, _encoding, origin: origin); 
+                int actualSize = SerializeInto(sample, serdataKind, buffer.AsSpan(0, totalSize));
                 
-                // Write CDR Header
-                if (_encoding == CdrEncoding.Xcdr2)
-                {
-                    if (BitConverter.IsLittleEndian)
-                    {
-                        // Little Endian
-                        cdr.WriteByte(0x00);
-                        cdr.WriteByte(_encodingKindLE);
-                    }
-                    else
-                    {
-                        // Big Endian
-                        cdr.WriteByte(0x00);
-                        cdr.WriteByte(_encodingKindBE);
-                    }
-                }
-                else
+                if (_topicName.Contains("UnionBoolDisc"))
+                    Console.WriteLine($"[DdsWriter] Sent {actualSize} bytes: {BitConverter.ToString(buffer, 0, actualSize)}");
+
+                // 4. Wrap in Serdata (native copies the buffer, except for managed-sertype topics)
+                unsafe
                 {
-                    // XCDR1
-                     if (BitConverter.IsLittleEndian)
-                    {
-                        cdr.WriteByte(0x00);
-                        cdr.WriteByte(0x01); // CDR_LE
-                    }
-                    else
+                    fixed (byte* p = buffer)
                     {
-                        cdr.WriteByte(0x00);
-                        cdr.WriteByte(0x00); // CDR_BE
+                        if (_managedSertype)
+                        {
+                            // Serdata references the buffer; it comes back via the release callback
+                            byte* keyHash = stackalloc byte[KeyHashWriter.HashSize];
+                            new Span<byte>(keyHash, KeyHashWriter.HashSize).Clear();
+                            _keyHasher?.Invoke(sample, new Span<byte>(keyHash, KeyHashWriter.HashSize));
+
+                            IntPtr bufferHandle = ManagedSertype.PinBuffer(buffer);
+                            IntPtr serdata = DdsApi.dds_managed_serdata_create(
+                                _topicHandle,
+                                serdataKind,
+                                (IntPtr)p,
+                                (uint)actualSize,
+                                bufferHandle,
+                                keyHash);
+
+                            if (serdata != IntPtr.Zero)
+                                bufferOwnedBySerdata = true;
+                            else
+                                GCHandle.FromIntPtr(bufferHandle).Free();
+                            return serdata;
+                        }
+
+                        if (_trustedProducer)
+                        {
+#if DEBUG
+                            VerifyTrustedCdr(p, actualSize, serdataKind);
+#endif
+                            bool attach = _attachKeyHash && keyHash;
+                            Span<byte> hash = attach ? stackalloc byte[KeyHashWriter.HashSize] : Span<byte>.Empty;
+                            if (attach) _keyHasher!(sample, hash);
+                            return DdsApi.dds_create_serdata_from_cdr_trusted(
+                                _topicHandle,
+                                (IntPtr)p,
+                                (uint)actualSize,
+                                serdataKind,
+                                hash);
+                        }
+
+                        if (_attachKeyHash && keyHash)
+                        {
+                            Span<byte> hash = stackalloc byte[KeyHashWriter.HashSize];
+                            _keyHasher!(sample, hash);
+                            return DdsApi.dds_create_serdata_from_cdr(
+                                _topicHandle,
+                                (IntPtr)p,
+                                (uint)actualSize,
+                                serdataKind,
+                                hash);
+                        }
+
+                        return DdsApi.dds_create_serdata_from_cdr(
+                            _topicHandle,
+                            (IntPtr)p,
+                            (uint)actualSize,
+                            serdataKind);
                     }
                 }
-                
-                // Options (2 bytes)
+            }
+            finally
+            {
+                if (!bufferOwnedBySerdata) Arena.Return(buffer);
+            }
+        }
+
+        /// <summary>
+        /// Writes header and sample (or only its key for SDK_KEY) into a buffer sized by
+        /// <see cref="GetSerializedBufferSize"/> and returns the number of bytes written.
+        /// </summary>
+        private int SerializeInto(in T sample, int serdataKind, Span<byte> span)
+        {
+            int origin = _encoding == CdrEncoding.Xcdr2 ? 0 : 4;
+            var cdr = new CdrWriter(span, _encoding, origin: origin);
+
+            WriteEncapsulationHeader(ref cdr, _encoding);
+
+            if (serdataKind == 1 && _keySerializer != null)
+            {
+                _keySerializer(sample, ref cdr);
+            }
+            else
+            {
+                _serializer!(sample, ref cdr);
+            }
+            cdr.Complete();
+
+            return cdr.Position;
+        }
+
+#if DEBUG
+        // Sampled cross-check of trusted mode: the first write and every TrustedVerifyInterval-th
+        // also go through the normalizing path, which rejects malformed CDR.
+        private const int TrustedVerifyInterval = 64;
+        private int _trustedVerifyCounter;
+
+        private unsafe void VerifyTrustedCdr(byte* data, int size, int serdataKind)
+        {
+            if (Interlocked.Increment(ref _trustedVerifyCounter) % TrustedVerifyInterval != 1) return;
+
+            IntPtr check = DdsApi.dds_create_serdata_from_cdr(_topicHandle, (IntPtr)data, (uint)size, serdataKind);
+            if (check == IntPtr.Zero)
+            {
+                throw new InvalidOperationException(
+                    $"Trusted-producer writer on '{_topicName}' produced CDR that fails native normalization.");
+            }
+            DdsApi.ddsi_serdata_unref(check);
+        }
+#endif
+
+        /// <summary>
+        /// Writes the 4-byte encapsulation header (representation identifier and options).
+        /// </summary>
+        internal static void WriteEncapsulationHeader(ref CdrWriter cdr, CdrEncoding encoding)
+        {
+            if (encoding == CdrEncoding.Xcdr2)
+            {
                 cdr.WriteByte(0x00);
+                cdr.WriteByte(BitConverter.IsLittleEndian ? _encodingKindLE : _encodingKindBE);
+            }
+            else
+            {
+                // XCDR1
                 cdr.WriteByte(0x00);
-                
-                if (serdataKind == 1 && _keySerializer != null)
+                cdr.WriteByte(BitConverter.IsLittleEndian ? (byte)0x01 : (byte)0x00); // CDR_LE / CDR_BE
+            }
+
+            // Options (2 bytes)
+            cdr.WriteByte(0x00);
+            cdr.WriteByte(0x00);
+        }
+
+        /// <summary>
+        /// Trusted-producer mode: serdata is created without Cyclone's CDR normalization pass,
+        /// saving a full read of the payload per write. Only correct because the buffer comes from
+        /// the generated serializer. In DEBUG builds a sample of writes is still cross-checked.
+        /// </summary>
+        /// <exception cref="NotSupportedException">The loaded ddsc lacks <c>dds_serdata_from_ser_iov_trusted</c>.</exception>
+        public bool TrustedProducer
+        {
+            get => _trustedProducer;
+            set
+            {
+                if (value && !DdsApi.HasExport(nameof(DdsApi.dds_serdata_from_ser_iov_trusted)))
                 {
-                    _keySerializer(sample, ref cdr);
+                    throw new NotSupportedException("The loaded ddsc does not export dds_serdata_from_ser_iov_trusted.");
                 }
-                else
+                _trustedProducer = value;
+            }
+        }
+
+        public void Write(in T sample)
+        {
+            PerformOperation(sample, _writeOperation, serializedSize: ChargePacing(sample));
+        }
+
+        /// <summary>
+        /// Charges <see cref="Pacing"/> for a write that is never refused. Returns the serialized size
+        /// when the byte limit needed it, so the write does not size the sample again, or -1.
+        /// </summary>
+        private int ChargePacing(in T sample)
+        {
+            var pacing = _pacing;
+            if (pacing == null) return -1;
+
+            int size = pacing.LimitsBytes ? GetSerializedBufferSize(sample, 2) : -1;
+            pacing.Charge(Math.Max(size, 0));
+            return size;
+        }
+
+        /// <summary>
+        /// Optional token bucket for <see cref="TryWrite"/> and <see cref="WriteAsync"/>; null (default) disables pacing.
+        /// Every other write (<see cref="Write(in T)"/>, <see cref="WriteIfChanged"/> when it publishes, <see cref="WriteRaw"/>,
+        /// serialized samples and templates) is charged without being refused. Dispose and unregister are not charged.
+        /// </summary>
+        public WriterPacing? Pacing
+        {
+            get => _pacing;
+            set => _pacing = value;
+        }
+
+        /// <summary>
+        /// Writes the sample if <see cref="Pacing"/> has credit for it, otherwise returns false without writing.
+        /// Always writes when no pacing is set.
+        /// </summary>
+        public bool TryWrite(in T sample)
+        {
+            int size = -1;
+            var pacing = _pacing;
+            if (pacing != null)
+            {
+                if (pacing.LimitsBytes) size = GetSerializedBufferSize(sample, 2);
+                if (!pacing.TryAcquire(Math.Max(size, 0), out _)) return false;
+            }
+
+            PerformOperation(sample, _writeOperation, serializedSize: size);
+            return true;
+        }
+
+        /// <summary>
+        /// Waits for <see cref="Pacing"/> credit, then writes the sample.
+        /// Completes synchronously when credit is available (or no pacing is set).
+        /// </summary>
+        public async ValueTask WriteAsync(T sample, CancellationToken cancellationToken = default)
+        {
+            int size = -1;
+            var pacing = _pacing;
+            if (pacing != null)
+            {
+                if (pacing.LimitsBytes) size = GetSerializedBufferSize(sample, 2);
+                while (!pacing.TryAcquire(Math.Max(size, 0), out var retryAfter))
                 {
-                    _serializer!(sample, ref cdr);
+                    await Task.Delay(retryAfter < MinPacingDelay ? MinPacingDelay : retryAfter, cancellationToken).ConfigureAwait(false);
                 }
-                cdr.Complete();
-                
-                int actualSize = cdr.Position;
-                
-                if (_topicName.Contains("UnionBoolDisc"))
-                    Console.WriteLine($"[DdsWriter] Sent {actualSize} bytes: {BitConverter.ToString(buffer, 0, actualSize)}");
+            }
 
-                // 4. Write to DDS via Serdata
-                unsafe
+            PerformOperation(sample, _writeOperation, serializedSize: size);
+        }
+
+        private static readonly TimeSpan MinPacingDelay = TimeSpan.FromMilliseconds(1);
+
+        /// <summary>
+        /// Writes the sample only if its serialized form differs from the last sample written by
+        /// this method for the same instance. Returns false when the write was skipped.
+        /// </summary>
+        /// <remarks>
+        /// The last CDR of each instance is kept in an arena buffer until the writer is disposed.
+        /// Instances are told apart by the generated key hash (or a digest of <c>SerializeKey</c>).
+        /// Any other write, dispose or unregister on this writer resets the comparison, so the
+        /// next call for every instance publishes again.
+        /// </remarks>
+        public bool WriteIfChanged(in T sample)
+        {
+            if (_writerHandle == null) throw new ObjectDisposedException(nameof(DdsWriter<T>));
+
+            int totalSize = GetSerializedBufferSize(sample, 2);
+            byte[] buffer = Arena.Rent(totalSize);
+            try
+            {
+                var cdr = buffer.AsSpan(0, SerializeInto(sample, 2, buffer.AsSpan(0, totalSize)));
+
+                Span<byte> keyHash = stackalloc byte[KeyHashWriter.HashSize];
+                ComputeInstanceDigest(sample, keyHash);
+                var key = (MemoryMarshal.Read<ulong>(keyHash), MemoryMarshal.Read<ulong>(keyHash.Slice(8)));
+
+                lock (_lastWrittenLock)
                 {
-                    fixed (byte* p = buffer)
+                    _lastWritten ??= new Dictionary<(ulong, ulong), (byte[] Buffer, int Length)>();
+
+                    int generation = Volatile.Read(ref _writeGeneration);
+                    if (generation != _lastWrittenGeneration)
                     {
-                        IntPtr dataPtr = (IntPtr)p;
-                        
-                        IntPtr serdata = DdsApi.dds_create_serdata_from_cdr(
-                            _topicHandle,
-                            dataPtr,
-                            (uint)actualSize,
-                            serdataKind);
+                        ReleaseLastWritten();
+                        _lastWrittenGeneration = generation;
+                    }
 
-                        if (serdata == IntPtr.Zero)
-                        {
-                             throw new DdsException(DdsApi.DdsReturnCode.Error, "dds_create_serdata_from_cdr failed");
-                        }
-                            
-                        // Operation consumes ref
-                        int ret = operation(_writerHandle.NativeHandle, serdata);
-                        if (ret < 0)
-                        {
-                            throw new DdsException((DdsApi.DdsReturnCode)ret, $"DDS operation failed: {ret}");
-                        }
+                    bool known = _lastWritten.TryGetValue(key, out var last);
+                    if (known && cdr.SequenceEqual(last.Buffer.AsSpan(0, last.Length)))
+                    {
+                        return false;
+                    }
+
+                    IntPtr serdata = CreateSerdataFromCdr(cdr, _keyHasher != null ? keyHash : ReadOnlySpan<byte>.Empty);
+                    if (serdata == IntPtr.Zero)
+                    {
+                        throw new DdsException(DdsApi.DdsReturnCode.Error, "dds_create_serdata_from_cdr failed");
+                    }
+
+                    // Skipped writes cost nothing
+                    _pacing?.Charge(cdr.Length);
+
+                    // dds_writecdr consumes the ref
+                    int ret = DdsApi.dds_writecdr(_writerHandle.NativeHandle, serdata);
+                    if (ret < 0)
+                    {
+                        throw new DdsException((DdsApi.DdsReturnCode)ret, $"dds_writecdr failed: {ret}");
                     }
+
+                    byte[] stored = known && last.Buffer.Length >= cdr.Length ? last.Buffer : Arena.Rent(cdr.Length);
+                    if (known && stored != last.Buffer) Arena.Return(last.Buffer);
+                    cdr.CopyTo(stored);
+                    _lastWritten[key] = (stored, cdr.Length);
+                    return true;
                 }
             }
             finally
@@ -277,9 +559,245 @@ namespace CycloneDDS.Runtime
             }
         }
 
-        public void Write(in T sample)
+        /// <summary>
+        /// Sends out samples held back by Cyclone's write batching (<c>dds_write_flush</c>).
+        /// Without batching enabled in the Cyclone configuration every write is sent immediately and this is a no-op.
+        /// </summary>
+        public void Flush()
+        {
+            if (_writerHandle == null) throw new ObjectDisposedException(nameof(DdsWriter<T>));
+
+            int ret = DdsApi.dds_write_flush(_writerHandle.NativeHandle);
+            if (ret < 0)
+            {
+                throw new DdsException((DdsApi.DdsReturnCode)ret, $"dds_write_flush failed: {ret}");
+            }
+        }
+
+        /// <summary>
+        /// 16 bytes identifying the instance of a sample: the generated key hash, an MD5 of the
+        /// key-only CDR when the key types have no key hash, or zeros for keyless topics.
+        /// </summary>
+        internal void ComputeInstanceDigest(in T sample, Span<byte> digest)
+        {
+            if (_keyHasher != null)
+            {
+                _keyHasher(sample, digest);
+                return;
+            }
+
+            if (_keySerializer == null)
+            {
+                digest.Clear();
+                return;
+            }
+
+            int size = GetSerializedBufferSize(sample, 1);
+            byte[] keyBuffer = Arena.Rent(size);
+            try
+            {
+                int length = SerializeInto(sample, 1, keyBuffer.AsSpan(0, size));
+                System.Security.Cryptography.MD5.HashData(keyBuffer.AsSpan(0, length), digest);
+            }
+            finally
+            {
+                Arena.Return(keyBuffer);
+            }
+        }
+
+        private void InvalidateLastWritten()
+        {
+            if (_lastWritten != null) Interlocked.Increment(ref _writeGeneration);
+        }
+
+        // Caller holds _lastWrittenLock
+        private void ReleaseLastWritten()
+        {
+            if (_lastWritten == null) return;
+            foreach (var entry in _lastWritten.Values)
+            {
+                Arena.Return(entry.Buffer);
+            }
+            _lastWritten.Clear();
+        }
+
+        /// <summary>
+        /// Writes an already serialized sample: CDR including the 4-byte encapsulation header,
+        /// e.g. from <see cref="RawSampleScope.GetCdr"/>. The bytes are copied and validated by
+        /// Cyclone (never trusted), so they must match the topic type's wire format.
+        /// </summary>
+        /// <exception cref="ArgumentException"><paramref name="cdr"/> is shorter than the encapsulation header.</exception>
+        public unsafe void WriteRaw(ReadOnlySpan<byte> cdr)
+        {
+            if (_writerHandle == null) throw new ObjectDisposedException(nameof(DdsWriter<T>));
+            if (cdr.Length < 4) throw new ArgumentException("CDR must include the 4-byte encapsulation header.", nameof(cdr));
+            InvalidateLastWritten();
+
+            IntPtr serdata;
+            fixed (byte* p = cdr)
+            {
+                serdata = DdsApi.dds_create_serdata_from_cdr(_topicHandle, (IntPtr)p, (uint)cdr.Length, 2);
+            }
+            if (serdata == IntPtr.Zero)
+            {
+                throw new DdsException(DdsApi.DdsReturnCode.BadParameter, "dds_create_serdata_from_cdr rejected the raw CDR");
+            }
+
+            _pacing?.Charge(cdr.Length);
+
+            // dds_writecdr consumes the ref
+            int ret = DdsApi.dds_writecdr(_writerHandle.NativeHandle, serdata);
+            if (ret < 0)
+            {
+                throw new DdsException((DdsApi.DdsReturnCode)ret, $"dds_writecdr failed: {ret}");
+            }
+        }
+
+        /// <summary>
+        /// Serializes the sample once for publishing through several writers with
+        /// <see cref="Write(SerializedSample{T})"/>. Dispose the result when done.
+        /// </summary>
+        public SerializedSample<T> Serialize(in T sample)
+        {
+            IntPtr serdata = CreateSerdata(sample, 2);
+            if (serdata == IntPtr.Zero)
+            {
+                throw new DdsException(DdsApi.DdsReturnCode.Error, "dds_create_serdata_from_cdr failed");
+            }
+
+            // Kept for writers on other sertypes, which need the hash but not the sample
+            byte[]? keyHash = null;
+            if (_keyHasher != null)
+            {
+                keyHash = new byte[KeyHashWriter.HashSize];
+                _keyHasher(sample, keyHash);
+            }
+
+            long timestamp = DdsApi.dds_time();
+            if (StampsSharedSamples) DdsApi.dds_serdata_set_source_timestamp(serdata, timestamp);
+
+            return new SerializedSample<T>(serdata, _sertype, keyHash, timestamp);
+        }
+
+        /// <summary>
+        /// Writes a sample serialized by <see cref="Serialize"/> (of this or any other writer of <typeparamref name="T"/>).
+        /// On a topic with the same sertype this only adds a reference to the shared serdata.
+        /// </summary>
+        public void Write(SerializedSample<T> sample)
+        {
+            if (sample == null) throw new ArgumentNullException(nameof(sample));
+            if (_writerHandle == null) throw new ObjectDisposedException(nameof(DdsWriter<T>));
+
+            IntPtr serdata = sample.GetSerdata(this, _sertype);
+            InvalidateLastWritten();
+
+            var pacing = _pacing;
+            pacing?.Charge(pacing.LimitsBytes ? sample.Size : 0);
+
+            // The write consumes the ref taken here; the sample keeps its own.
+            // dds_forwardcdr leaves the stamp from Serialize alone: the serdata is shared.
+            DdsApi.ddsi_serdata_ref(serdata);
+            int ret = StampsSharedSamples
+                ? DdsApi.dds_forwardcdr(_writerHandle.NativeHandle, serdata)
+                : DdsApi.dds_writecdr(_writerHandle.NativeHandle, serdata);
+            if (ret < 0)
+            {
+                throw new DdsException((DdsApi.DdsReturnCode)ret, $"dds_{(StampsSharedSamples ? "forward" : "write")}cdr failed: {ret}");
+            }
+        }
+
+        /// <summary>
+        /// Serializes the sample into a <see cref="SampleTemplate{T}"/> whose fixed-layout members
+        /// can be patched in place and written with <see cref="Write(SampleTemplate{T})"/>.
+        /// </summary>
+        /// <exception cref="NotSupportedException">The type was generated without <c>TryGetFieldOffset</c>.</exception>
+        public SampleTemplate<T> CreateTemplate(in T sample)
+        {
+            if (_writerHandle == null) throw new ObjectDisposedException(nameof(DdsWriter<T>));
+            if (!SampleTemplate<T>.IsSupported)
+            {
+                throw new NotSupportedException($"Type {typeof(T).Name} has no generated TryGetFieldOffset.");
+            }
+
+            int totalSize = GetSerializedBufferSize(sample, 2);
+            byte[] buffer = Arena.Rent(totalSize);
+            int length = SerializeInto(sample, 2, buffer.AsSpan(0, totalSize));
+
+            // Key members are not patchable, so the hash stays valid for the template's lifetime
+            byte[]? keyHash = null;
+            if (_keyHasher != null)
+            {
+                keyHash = new byte[KeyHashWriter.HashSize];
+                _keyHasher(sample, keyHash);
+            }
+
+            return new SampleTemplate<T>(buffer, length, _encoding, keyHash);
+        }
+
+        /// <summary>
+        /// Writes the current contents of a template without serializing.
+        /// </summary>
+        public void Write(SampleTemplate<T> template)
         {
-            PerformOperation(sample, _writeOperation);
+            if (template == null) throw new ArgumentNullException(nameof(template));
+            if (_writerHandle == null) throw new ObjectDisposedException(nameof(DdsWriter<T>));
+
+            InvalidateLastWritten();
+            IntPtr serdata = CreateSerdataFromCdr(template.Cdr, template.KeyHash);
+            if (serdata == IntPtr.Zero)
+            {
+                throw new DdsException(DdsApi.DdsReturnCode.Error, "dds_create_serdata_from_cdr failed");
+            }
+
+            _pacing?.Charge(template.Cdr.Length);
+
+            // dds_writecdr consumes the ref
+            int ret = DdsApi.dds_writecdr(_writerHandle.NativeHandle, serdata);
+            if (ret < 0)
+            {
+                throw new DdsException((DdsApi.DdsReturnCode)ret, $"dds_writecdr failed: {ret}");
+            }
+        }
+
+        /// <summary>
+        /// Serdata for this writer's topic from CDR produced by the generated serializer
+        /// (templates, change tracking, and <see cref="SerializedSample{T}"/> crossing sertypes).
+        /// <paramref name="keyHash"/> is the generated key hash, or empty.
+        /// </summary>
+        internal unsafe IntPtr CreateSerdataFromCdr(ReadOnlySpan<byte> cdr, ReadOnlySpan<byte> keyHash)
+        {
+            if (!_topicHandle.IsValid) throw new ObjectDisposedException(nameof(DdsWriter<T>));
+
+            if (_managedSertype)
+            {
+                byte[] buffer = Arena.Rent(cdr.Length);
+                cdr.CopyTo(buffer);
+
+                byte* hash = stackalloc byte[KeyHashWriter.HashSize];
+                var hashSpan = new Span<byte>(hash, KeyHashWriter.HashSize);
+                hashSpan.Clear();
+                keyHash.CopyTo(hashSpan);
+
+                IntPtr bufferHandle = ManagedSertype.PinBuffer(buffer);
+                fixed (byte* p = buffer)
+                {
+                    IntPtr serdata = DdsApi.dds_managed_serdata_create(_topicHandle, 2, (IntPtr)p, (uint)cdr.Length, bufferHandle, hash);
+                    if (serdata == IntPtr.Zero) ManagedSertype.ReleaseBuffer(bufferHandle);
+                    return serdata;
+                }
+            }
+
+            ReadOnlySpan<byte> attachedHash = _attachKeyHash ? keyHash : ReadOnlySpan<byte>.Empty;
+            fixed (byte* p = cdr)
+            {
+                if (_trustedProducer)
+                {
+                    return DdsApi.dds_create_serdata_from_cdr_trusted(_topicHandle, (IntPtr)p, (uint)cdr.Length, 2, attachedHash);
+                }
+                return attachedHash.IsEmpty
+                    ? DdsApi.dds_create_serdata_from_cdr(_topicHandle, (IntPtr)p, (uint)cdr.Length, 2)
+                    : DdsApi.dds_create_serdata_from_cdr(_topicHandle, (IntPtr)p, (uint)cdr.Length, 2, attachedHash);
+            }
         }
 
         /// <summary>
@@ -289,7 +807,7 @@ namespace CycloneDDS.Runtime
         /// <param name="sample">Sample containing the key to dispose (non-key fields ignored)</param>
         /// <remarks>
         /// For keyed topics only. The key fields identify which instance to dispose.
-        /// Non-key fields are serialized but ignored by CycloneDDS.
+        /// Only the key fields are serialized (generated SerializeKey).
         /// This operation maintains the zero-allocation guarantee.
         /// </remarks>
         public void DisposeInstance(in T sample)
@@ -306,7 +824,7 @@ namespace CycloneDDS.Runtime
         /// <remarks>
         /// Useful for graceful shutdown or ownership transfer scenarios.
         /// For keyed topics only. The key fields identify which instance to unregister.
-        /// Non-key fields are serialized but ignored by CycloneDDS.
+        /// Only the key fields are serialized (generated SerializeKey).
         /// This operation maintains the zero-allocation guarantee.
         /// </remarks>
         public void UnregisterInstance(in T sample)
@@ -314,6 +832,175 @@ namespace CycloneDDS.Runtime
             PerformOperation(sample, _unregisterOperation, 1); // SDK_KEY
         }
         
+        /// <summary>
+        /// Register an instance and return its handle.
+        /// </summary>
+        /// <param name="keySample">Sample containing the key to register (non-key fields ignored)</param>
+        /// <remarks>
+        /// The key is serialized once. The writer keeps the resulting key serdata and the native instance
+        /// entry until the instance is unregistered by handle or the writer is disposed, so
+        /// <see cref="Write(in T, DdsInstanceHandle)"/>, <see cref="DisposeInstance(DdsInstanceHandle)"/> and
+        /// <see cref="UnregisterInstance(DdsInstanceHandle)"/> neither hash nor look up the key.
+        /// Registering an already registered key returns the same handle.
+        /// </remarks>
+        /// <exception cref="NotSupportedException">The loaded ddsc lacks <c>dds_register_instance_serdata</c>.</exception>
+        public DdsInstanceHandle RegisterInstance(in T keySample)
+        {
+            DdsApi.RequireExport(nameof(DdsApi.dds_register_instance_serdata));
+
+            IntPtr serdata = CreateSerdata(keySample, 1); // SDK_KEY
+            if (serdata == IntPtr.Zero)
+            {
+                throw new DdsException(DdsApi.DdsReturnCode.Error, "dds_create_serdata_from_cdr failed");
+            }
+
+            int ret = DdsApi.dds_register_instance_serdata(_writerHandle!.NativeHandle, out long handle, serdata);
+            if (ret < 0)
+            {
+                DdsApi.ddsi_serdata_unref(serdata);
+                throw new DdsException((DdsApi.DdsReturnCode)ret, $"dds_register_instance_serdata failed: {ret}");
+            }
+
+            lock (_instanceLock)
+            {
+                if (_registeredInstances.ContainsKey(handle))
+                {
+                    DdsApi.ddsi_serdata_unref(serdata);
+                }
+                else
+                {
+                    IntPtr tk = _writesByInstance ? DdsApi.dds_instance_tk_ref(_writerHandle.NativeHandle, serdata) : IntPtr.Zero;
+                    _registeredInstances[handle] = new RegisteredInstance(serdata, tk);
+                }
+            }
+            return new DdsInstanceHandle(handle);
+        }
+
+        /// <summary>
+        /// Write a sample of an instance registered with <see cref="RegisterInstance"/>.
+        /// </summary>
+        /// <param name="sample">Sample to write; its key must match the registered instance</param>
+        /// <param name="handle">Handle returned by <see cref="RegisterInstance"/> on this writer</param>
+        /// <exception cref="ArgumentException">
+        /// The handle is not registered with this writer, or the sample's key belongs to another instance.
+        /// </exception>
+        /// <exception cref="NotSupportedException">The loaded ddsc lacks <c>dds_write_serdata_tk</c>.</exception>
+        /// <remarks>
+        /// The sample is written to the native instance entry cached at registration: the generated key hash
+        /// is not computed and Cyclone does not look the key up. Cyclone only compares the sample's key with
+        /// the instance's (for managed-sertype topics the key hash is still computed for that comparison).
+        /// </remarks>
+        public void Write(in T sample, DdsInstanceHandle handle)
+        {
+            if (!_writesByInstance) DdsApi.RequireExport(nameof(DdsApi.dds_write_serdata_tk));
+
+            int serializedSize = ChargePacing(sample);
+            InvalidateLastWritten();
+
+            IntPtr serdata = CreateSerdata(sample, 2, serializedSize, keyHash: false);
+            if (serdata == IntPtr.Zero)
+            {
+                throw new DdsException(DdsApi.DdsReturnCode.Error, "dds_create_serdata_from_cdr failed");
+            }
+
+            int ret;
+            lock (_instanceLock)
+            {
+                // The lock keeps the entry alive until the write has taken its own ref
+                if (!_registeredInstances.TryGetValue(handle.Value, out var instance) || instance.Tk == IntPtr.Zero)
+                {
+                    DdsApi.ddsi_serdata_unref(serdata);
+                    throw new ArgumentException($"{handle} is not registered with this writer", nameof(handle));
+                }
+                ret = DdsApi.dds_write_serdata_tk(_writerHandle!.NativeHandle, serdata, instance.Tk);
+            }
+
+            if (ret == (int)DdsApi.DdsReturnCode.PreconditionNotMet)
+                throw new ArgumentException($"The sample's key does not belong to {handle}", nameof(sample));
+            if (ret < 0)
+                throw new DdsException((DdsApi.DdsReturnCode)ret, $"dds_write_serdata_tk failed: {ret}");
+        }
+
+        private readonly struct RegisteredInstance
+        {
+            public readonly IntPtr KeySerdata;
+            public readonly IntPtr Tk;
+
+            public RegisteredInstance(IntPtr keySerdata, IntPtr tk)
+            {
+                KeySerdata = keySerdata;
+                Tk = tk;
+            }
+        }
+
+        /// <summary>
+        /// Dispose an instance by handle.
+        /// Marks the instance as NOT_ALIVE_DISPOSED in the reader.
+        /// </summary>
+        /// <param name="handle">Instance handle (from <see cref="RegisterInstance"/> or <see cref="LookupInstance"/>)</param>
+        /// <remarks>
+        /// Instances registered through this writer reuse their cached key serdata (no serialization).
+        /// Other handles go through <c>dds_dispose_ih</c>.
+        /// </remarks>
+        public void DisposeInstance(DdsInstanceHandle handle)
+        {
+            if (_writerHandle == null) throw new ObjectDisposedException(nameof(DdsWriter<T>));
+            InvalidateLastWritten();
+
+            int ret;
+            IntPtr keySerdata = IntPtr.Zero;
+            lock (_instanceLock)
+            {
+                // Take an extra ref under the lock; the operation consumes it
+                if (_registeredInstances.TryGetValue(handle.Value, out var cached))
+                    keySerdata = DdsApi.ddsi_serdata_ref(cached.KeySerdata);
+            }
+
+            if (keySerdata != IntPtr.Zero)
+                ret = DdsApi.dds_dispose_serdata(_writerHandle.NativeHandle, keySerdata);
+            else
+                ret = DdsApi.dds_dispose_ih(_writerHandle.NativeHandle, handle.Value);
+
+            if (ret < 0)
+            {
+                throw new DdsException((DdsApi.DdsReturnCode)ret, $"DDS operation failed: {ret}");
+            }
+        }
+
+        /// <summary>
+        /// Unregister an instance by handle (writer releases ownership).
+        /// </summary>
+        /// <param name="handle">Instance handle (from <see cref="RegisterInstance"/> or <see cref="LookupInstance"/>)</param>
+        /// <remarks>
+        /// Releases the cached key serdata of instances registered through this writer.
+        /// Other handles go through <c>dds_unregister_instance_ih</c>.
+        /// </remarks>
+        public void UnregisterInstance(DdsInstanceHandle handle)
+        {
+            if (_writerHandle == null) throw new ObjectDisposedException(nameof(DdsWriter<T>));
+            InvalidateLastWritten();
+
+            int ret;
+            IntPtr keySerdata;
+            lock (_instanceLock)
+            {
+                // The cached key serdata ref (if any) is handed over to the operation
+                _registeredInstances.Remove(handle.Value, out var cached);
+                keySerdata = cached.KeySerdata;
+                if (cached.Tk != IntPtr.Zero) DdsApi.dds_instance_tk_unref(_writerHandle.NativeHandle, cached.Tk);
+            }
+
+            if (keySerdata != IntPtr.Zero)
+                ret = DdsApi.dds_unregister_serdata(_writerHandle.NativeHandle, keySerdata);
+            else
+                ret = DdsApi.dds_unregister_instance_ih(_writerHandle.NativeHandle, handle.Value);
+
+            if (ret < 0)
+            {
+                throw new DdsException((DdsApi.DdsReturnCode)ret, $"DDS operation failed: {ret}");
+            }
+        }
+        
         public event EventHandler<DdsApi.DdsPublicationMatchedStatus>? PublicationMatched
         {
             add 
@@ -365,6 +1052,151 @@ namespace CycloneDDS.Runtime
              }
         }
 
+        /// <summary>
+        /// Waits indefinitely until everything written so far has been acknowledged by all matched
+        /// reliable readers (<c>dds_wait_for_acks</c>).
+        /// </summary>
+        public Task<bool> WaitForAcknowledgmentsAsync(CancellationToken cancellationToken = default)
+        {
+            return WaitForAcknowledgmentsAsync(Timeout.InfiniteTimeSpan, cancellationToken);
+        }
+
+        /// <summary>
+        /// Waits until everything written so far has been acknowledged by all matched reliable readers.
+        /// Returns false on timeout; <see cref="Timeout.InfiniteTimeSpan"/> waits indefinitely and
+        /// <see cref="TimeSpan.Zero"/> only checks.
+        /// </summary>
+        /// <remarks>
+        /// Completes synchronously when nothing is outstanding. Otherwise the wait is for the samples written
+        /// up to this call only, and is served by the writer's single acknowledgment thread (started on first
+        /// use), which notices cancellation within 100 ms.
+        /// </remarks>
+        /// <exception cref="ArgumentOutOfRangeException"><paramref name="timeout"/> is negative and not infinite.</exception>
+        /// <exception cref="NotSupportedException">
+        /// The loaded ddsc lacks <c>dds_wait_for_acks_seq</c> (only for waits that do not complete synchronously).
+        /// </exception>
+        public Task<bool> WaitForAcknowledgmentsAsync(TimeSpan timeout, CancellationToken cancellationToken = default)
+        {
+            if (timeout < TimeSpan.Zero && timeout != Timeout.InfiniteTimeSpan)
+            {
+                throw new ArgumentOutOfRangeException(nameof(timeout));
+            }
+            if (cancellationToken.IsCancellationRequested) return Task.FromCanceled<bool>(cancellationToken);
+
+            if (WaitForAcks(TimeSpan.Zero)) return Task.FromResult(true);
+            if (timeout == TimeSpan.Zero) return Task.FromResult(false);
+
+            DdsApi.RequireExport(nameof(DdsApi.dds_wait_for_acks_seq));
+            var handle = _writerHandle ?? throw new ObjectDisposedException(nameof(DdsWriter<T>));
+
+            int ret = DdsApi.dds_writer_last_seq(handle.NativeHandle, out ulong seq);
+            if (ret < 0) throw new DdsException((DdsApi.DdsReturnCode)ret, $"dds_writer_last_seq failed: {ret}");
+
+            return GetAckWaiter(handle).WaitAsync(seq, timeout, cancellationToken);
+        }
+
+        private AckWaiter GetAckWaiter(DdsEntityHandle handle)
+        {
+            var waiter = Volatile.Read(ref _ackWaiter);
+            if (waiter != null) return waiter;
+
+            waiter = new AckWaiter(handle.NativeHandle, _topicName);
+            return Interlocked.CompareExchange(ref _ackWaiter, waiter, null) ?? waiter;
+        }
+
+        private bool WaitForAcks(TimeSpan timeout)
+        {
+            var handle = _writerHandle ?? throw new ObjectDisposedException(nameof(DdsWriter<T>));
+
+            int ret = DdsApi.dds_wait_for_acks(handle.NativeHandle, timeout.Ticks * 100);
+            if (ret == (int)DdsApi.DdsReturnCode.Ok) return true;
+            if (ret == (int)DdsApi.DdsReturnCode.Timeout) return false;
+
+            if (_writerHandle == null) throw new ObjectDisposedException(nameof(DdsWriter<T>));
+            throw new DdsException((DdsApi.DdsReturnCode)ret, $"dds_wait_for_acks failed: {ret}");
+        }
+
+        /// <summary>
+        /// Writes a sequence of samples keeping at most <paramref name="window"/> of them unacknowledged.
+        /// Returns the number of samples written.
+        /// </summary>
+        /// <remarks>
+        /// The samples go out in half windows: after each half the writer flushes and starts waiting for its
+        /// acknowledgment, while the next half is written; before a third half starts, the wait for the first
+        /// must have completed. Writer history and reader buffering stay bounded by the window. For sustained
+        /// throughput the window should cover the bandwidth-delay product of the link; pacing set on
+        /// <see cref="Pacing"/> is honoured between writes.
+        /// </remarks>
+        /// <param name="samples">Samples to send, enumerated once.</param>
+        /// <param name="window">Maximum number of samples in flight.</param>
+        /// <param name="ackTimeout">Time allowed for each half window to be acknowledged; null waits indefinitely.</param>
+        /// <param name="cancellationToken">Stops the transfer between samples.</param>
+        /// <exception cref="TimeoutException">A half window was not acknowledged within <paramref name="ackTimeout"/>.</exception>
+        public async Task<long> SendBulkAsync(IEnumerable<T> samples, int window = 256, TimeSpan? ackTimeout = null,
+            CancellationToken cancellationToken = default)
+        {
+            if (samples == null) throw new ArgumentNullException(nameof(samples));
+            if (window <= 0) throw new ArgumentOutOfRangeException(nameof(window));
+
+            var timeout = ackTimeout ?? Timeout.InfiniteTimeSpan;
+            int half = Math.Max(1, window / 2);
+            long written = 0;
+            int inFlight = 0;
+            Task<bool>? pending = null;
+
+            foreach (var sample in samples)
+            {
+                cancellationToken.ThrowIfCancellationRequested();
+
+                if (inFlight == half)
+                {
+                    pending = await AcknowledgeHalfAsync(pending, timeout, cancellationToken).ConfigureAwait(false);
+                    inFlight = 0;
+                }
+
+                if (_pacing != null)
+                {
+                    await WriteAsync(sample, cancellationToken).ConfigureAwait(false);
+                }
+                else
+                {
+                    Write(sample);
+                }
+                written++;
+                inFlight++;
+            }
+
+            if (inFlight > 0)
+            {
+                pending = await AcknowledgeHalfAsync(pending, timeout, cancellationToken).ConfigureAwait(false);
+            }
+            if (pending != null)
+            {
+                await EnsureAcknowledgedAsync(pending, timeout).ConfigureAwait(false);
+            }
+            return written;
+        }
+
+        // Starts the wait for what was just written, then finishes the wait for the previous half
+        private async Task<Task<bool>> AcknowledgeHalfAsync(Task<bool>? previous, TimeSpan timeout, CancellationToken cancellationToken)
+        {
+            Flush();
+            var current = WaitForAcknowledgmentsAsync(timeout, cancellationToken);
+            if (previous != null)
+            {
+                await EnsureAcknowledgedAsync(previous, timeout).ConfigureAwait(false);
+            }
+            return current;
+        }
+
+        private async Task EnsureAcknowledgedAsync(Task<bool> acknowledged, TimeSpan timeout)
+        {
+            if (!await acknowledged.ConfigureAwait(false))
+            {
+                throw new TimeoutException($"Readers of '{_topicName}' did not acknowledge within {timeout}.");
+            }
+        }
+
         private void EnsureListenerAttached()
         {
              if (_listener != IntPtr.Zero) return;
@@ -408,56 +1240,18 @@ namespace CycloneDDS.Runtime
         {
             if (_writerHandle == null) throw new ObjectDisposedException(nameof(DdsWriter<T>));
 
-            // Use _sizer to calculate size. Start at offset 4 for header
-            int size = _sizer!(keySample, 4, _encoding);
-            byte[] buffer = Arena.Rent(size + 4);
+            // Kind=1 (SDK_KEY): key-only serialization
+            IntPtr serdata = CreateSerdata(keySample, 1);
+            if (serdata == IntPtr.Zero) return DdsInstanceHandle.Nil;
 
             try
             {
-                var span = buffer.AsSpan(0, size + 4);
-                var cdr = new CdrWriter(span, _encoding);
-                
-                // Write Header
-                if (_encoding == CdrEncoding.Xcdr2)
-                {
-                    if (BitConverter.IsLittleEndian) { cdr.WriteByte(0x00); cdr.WriteByte(_encodingKindLE); }
-                    else { cdr.WriteByte(0x00); cdr.WriteByte(_encodingKindBE); }
-                }
-                else
-                {
-                    if (BitConverter.IsLittleEndian) { cdr.WriteByte(0x00); cdr.WriteByte(0x01); }
-                    else { cdr.WriteByte(0x00); cdr.WriteByte(0x00); }
-                }
-
-                cdr.WriteByte(0x00); cdr.WriteByte(0x00);
-
-                _serializer!(keySample, ref cdr);
-                
-                unsafe
-                {
-                    fixed (byte* p = buffer)
-                    {
-                        // 2. Create Serdata (Kind=1 for SDK_KEY)
-                        IntPtr serdata = DdsApi.dds_create_serdata_from_cdr(
-                            _topicHandle, (IntPtr)p, (uint)(size + 4), 1);
-                            
-                        if (serdata == IntPtr.Zero) return DdsInstanceHandle.Nil;
-
-                        try
-                        {
-                            long handle = DdsApi.dds_lookup_instance_serdata(_writerHandle.NativeHandle.Handle, serdata);
-                            return new DdsInstanceHandle(handle);
-                        }
-                        finally
-                        {
-                            DdsApi.ddsi_serdata_unref(serdata);
-                        }
-                    }
-                }
+                long handle = DdsApi.dds_lookup_instance_serdata(_writerHandle.NativeHandle.Handle, serdata);
+                return new DdsInstanceHandle(handle);
             }
             finally
             {
-                Arena.Return(buffer);
+                DdsApi.ddsi_serdata_unref(serdata);
             }
         }
 
@@ -477,12 +1271,89 @@ namespace CycloneDDS.Runtime
             }
             if (_paramHandle.IsAllocated) _paramHandle.Free();
 
+            lock (_lastWrittenLock)
+            {
+                ReleaseLastWritten();
+            }
+
+            lock (_instanceLock)
+            {
+                foreach (var instance in _registeredInstances.Values)
+                {
+                    if (instance.Tk != IntPtr.Zero && _writerHandle != null)
+                        DdsApi.dds_instance_tk_unref(_writerHandle.NativeHandle, instance.Tk);
+                    DdsApi.ddsi_serdata_unref(instance.KeySerdata);
+                }
+                _registeredInstances.Clear();
+            }
+
+            // No native wait may outlive the writer
+            Interlocked.Exchange(ref _ackWaiter, null)?.Dispose();
+
             _writerHandle?.Dispose();
             _writerHandle = null;
             _topicHandle = DdsApi.DdsEntity.Null;
+            _sertype = IntPtr.Zero;
             _participant = null;
         }
 
+        /// <summary>
+        /// Forces static initialization and JIT of the serialization path and runs it once
+        /// on a synthetic sample (see <see cref="DdsTypeSupport.CreateSample{T}"/>).
+        /// Returns the serialized size including the encapsulation header.
+        /// </summary>
+        internal static int Prewarm()
+        {
+            if (_sizer == null || _serializer == null)
+            {
+                throw new InvalidOperationException($"Type {typeof(T).Name} does not exhibit expected DDS generated methods (Serialize, GetSerializedSize).");
+            }
+
+            DdsTypeSupport.PrepareGeneratedMethod(typeof(T), "GetSerializedSize", typeof(int), typeof(CdrEncoding));
+            DdsTypeSupport.PrepareGeneratedMethod(typeof(T), "Serialize", typeof(CdrWriter).MakeByRefType());
+            DdsTypeSupport.PrepareGeneratedMethod(typeof(T), "SerializeKey", typeof(CdrWriter).MakeByRefType());
+            DdsTypeSupport.PrepareGeneratedMethod(typeof(T), "GetKeySerializedSize", typeof(int), typeof(CdrEncoding));
+            DdsTypeSupport.PrepareGeneratedMethod(typeof(T), "ComputeKeyHash", typeof(T).MakeByRefType(), typeof(Span<byte>));
+
+            CdrEncoding encoding = _extensibilityKind == DdsExtensibilityKind.Final ? CdrEncoding.Xcdr1 : CdrEncoding.Xcdr2;
+            int origin = encoding == CdrEncoding.Xcdr2 ? 0 : 4;
+            T sample = DdsTypeSupport.CreateSample<T>();
+
+            int totalSize = _sizer(sample, 4 + origin, encoding) + 4;
+            byte[] buffer = Arena.Rent(totalSize);
+            try
+            {
+                var cdr = new CdrWriter(buffer.AsSpan(0, totalSize), encoding, origin: origin);
+                WriteEncapsulationHeader(ref cdr, encoding);
+                _serializer(sample, ref cdr);
+                cdr.Complete();
+
+                if (_keySerializer != null)
+                {
+                    cdr = new CdrWriter(buffer.AsSpan(0, totalSize), encoding, origin: origin);
+                    WriteEncapsulationHeader(ref cdr, encoding);
+                    _keySerializer(sample, ref cdr);
+                    cdr.Complete();
+                }
+
+                _keyHasher?.Invoke(sample, stackalloc byte[KeyHashWriter.HashSize]);
+            }
+            finally
+            {
+                Arena.Return(buffer);
+            }
+
+            Volatile.Write(ref _prewarmed, true);
+            return totalSize;
+        }
+
+        /// <summary>
+        /// True once <see cref="Prewarm"/> has run the serialization path for <typeparamref name="T"/>.
+        /// </summary>
+        internal static bool IsPrewarmed => Volatile.Read(ref _prewarmed);
+
+        private static bool _prewarmed;
+
         // --- Delegate Generators ---
         private static GetSerializedSizeDelegate CreateSizerDelegate()
         {
@@ -541,31 +1412,6 @@ namespace CycloneDDS.Runtime
 
             return (SerializeDelegate)dm.CreateDelegate(typeof(SerializeDelegate));
         }
-
-        private static SerializeDelegate? CreateKeySerializerDelegate()
-        {
-            var method = typeof(T).GetMethod("SerializeKey", new[] { typeof(CdrWriter).MakeByRefType() });
-            Console.WriteLine($"[DEBUG] Type {typeof(T).Name} SerializeKey found: {method != null}");
-            if (method == null) return null;
-
-            var dm = new DynamicMethod(
-                "SerializeKeyThunk",
-                typeof(void),
-                new[] { typeof(T).MakeByRefType(), typeof(CdrWriter).MakeByRefType() },
-                typeof(DdsWriter<T>).Module);
-
-            var il = dm.GetILGenerator();
-            il.Emit(OpCodes.Ldarg_0); // sample (ref)
-            if (!typeof(T).IsValueType)
-            {
-                il.Emit(OpCodes.Ldind_Ref);
-            }
-            il.Emit(OpCodes.Ldarg_1); // writer (ref)
-            il.Emit(OpCodes.Call, method);
-            il.Emit(OpCodes.Ret);
-
-            return (SerializeDelegate)dm.CreateDelegate(typeof(SerializeDelegate));
-        }
     }
 
 }
@@ -0,0 +1,447 @@
+using System;
+using System.Collections.Generic;
+using System.Runtime.CompilerServices;
+using System.Threading;
+using System.Threading.Tasks;
+
+namespace CycloneDDS.Runtime
+{
+    /// <summary>
+    /// Time-indexed history per instance, kept on the managed side: samples taken from a reader are stored
+    /// with their source timestamps in preallocated per-instance rings and queried by time range.
+    /// <code>
+    /// var history = new HistoryStore&lt;SensorData&gt;(reader, capacityPerInstance: 4096);
+    /// _ = history.RunAsync(cts.Token);
+    /// using (var last30s = history.QueryLast(new SensorData { SensorId = 7 }, TimeSpan.FromSeconds(30)))
+    /// {
+    ///     foreach (ref readonly var s in last30s) { ... }
+    /// }
+    /// </code>
+    /// </summary>
+    /// <remarks>
+    /// <para>
+    /// Each instance gets a ring of <c>capacityPerInstance</c> samples on first sight; when full, the oldest
+    /// sample is overwritten. Rings are allocated up to <c>maxBytes</c> (counted as the inline size of
+    /// <typeparamref name="T"/> plus the timestamp; heap data referenced by <typeparamref name="T"/> is not counted),
+    /// after which the least recently updated instance's ring is reused for the new one (found in O(1) through
+    /// an LRU list).
+    /// </para>
+    /// <para>
+    /// Queries binary-search the timestamps and return spans over the rings without copying. The returned
+    /// <see cref="HistoryRange{T}"/> is a lease: it holds the store's lock until disposed, so the rings cannot
+    /// change underneath it, and feeding waits meanwhile. Keep leases short, dispose them on the querying thread,
+    /// or use <see cref="CopyRange"/>.
+    /// </para>
+    /// </remarks>
+    public sealed class HistoryStore<T> where T : struct
+    {
+        private readonly DdsReader<T, T> _reader;
+        private readonly int _capacity;
+        private readonly int _maxInstances;
+        private readonly Dictionary<long, Ring> _rings = new();
+        private readonly object _lock = new object();
+
+        // Rings by last update, least recent first
+        private Ring? _lruHead;
+        private Ring? _lruTail;
+
+        /// <param name="reader">Reader the store takes samples from.</param>
+        /// <param name="capacityPerInstance">Samples kept per instance.</param>
+        /// <param name="maxBytes">Upper bound for ring memory across all instances.</param>
+        /// <exception cref="ArgumentException">A single ring does not fit into <paramref name="maxBytes"/>.</exception>
+        public HistoryStore(DdsReader<T, T> reader, int capacityPerInstance = 1024, long maxBytes = 64L * 1024 * 1024)
+        {
+            if (reader == null) throw new ArgumentNullException(nameof(reader));
+            if (capacityPerInstance <= 0) throw new ArgumentOutOfRangeException(nameof(capacityPerInstance));
+
+            long ringBytes = (long)capacityPerInstance * SlotBytes;
+            if (maxBytes < ringBytes)
+            {
+                throw new ArgumentException($"maxBytes ({maxBytes}) is smaller than one ring ({ringBytes} bytes).", nameof(maxBytes));
+            }
+
+            _reader = reader;
+            _capacity = capacityPerInstance;
+            _maxInstances = (int)Math.Min(int.MaxValue, maxBytes / ringBytes);
+        }
+
+        /// <summary>Accounted bytes per stored sample.</summary>
+        public static int SlotBytes => Unsafe.SizeOf<T>() + sizeof(long);
+
+        public int CapacityPerInstance => _capacity;
+
+        /// <summary>Number of instances the byte limit allows.</summary>
+        public int MaxInstances => _maxInstances;
+
+        public int InstanceCount
+        {
+            get { lock (_lock) return _rings.Count; }
+        }
+
+        /// <summary>Ring memory currently allocated, as accounted against the byte limit.</summary>
+        public long AllocatedBytes
+        {
+            get { lock (_lock) return (long)_rings.Count * _capacity * SlotBytes; }
+        }
+
+        /// <summary>
+        /// Takes up to <paramref name="maxSamples"/> samples from the reader into the store.
+        /// Returns the number of samples taken.
+        /// </summary>
+        public int Poll(int maxSamples = 256)
+        {
+            using var scope = _reader.Take(maxSamples);
+            var infos = scope.Infos;
+
+            lock (_lock)
+            {
+                for (int i = 0; i < scope.Count; i++)
+                {
+                    if (infos[i].ValidData == 0) continue;
+                    Append(GetOrAddRing(infos[i].InstanceHandle), scope[i], infos[i].SourceTimestamp);
+                }
+            }
+            return scope.Count;
+        }
+
+        /// <summary>
+        /// Feeds the store from the reader until cancelled.
+        /// </summary>
+        public async Task RunAsync(CancellationToken cancellationToken = default)
+        {
+            while (!cancellationToken.IsCancellationRequested)
+            {
+                while (Poll() > 0) { }
+                await _reader.WaitDataAsync(cancellationToken).ConfigureAwait(false);
+            }
+        }
+
+        /// <summary>
+        /// Samples of an instance with <paramref name="fromNs"/> &lt;= source timestamp &lt;= <paramref name="toNs"/>
+        /// (nanoseconds since the Unix epoch), oldest first. Holds the store's lock until disposed.
+        /// </summary>
+        public HistoryRange<T> Query(DdsInstanceHandle instance, long fromNs, long toNs)
+        {
+            Monitor.Enter(_lock);
+            var range = QueryCore(instance, fromNs, toNs);
+            if (range.IsEmpty)
+            {
+                Monitor.Exit(_lock);
+                return default;
+            }
+            return range.WithLease(_lock);
+        }
+
+        /// <summary>
+        /// Samples of the instance identified by the key members of <paramref name="keySample"/>.
+        /// </summary>
+        public HistoryRange<T> Query(in T keySample, long fromNs, long toNs)
+        {
+            return Query(_reader.LookupInstance(keySample), fromNs, toNs);
+        }
+
+        /// <summary>
+        /// Samples of an instance stamped within <paramref name="window"/> before now.
+        /// </summary>
+        public HistoryRange<T> QueryLast(DdsInstanceHandle instance, TimeSpan window)
+        {
+            return Query(instance, NowNs() - window.Ticks * 100, long.MaxValue);
+        }
+
+        public HistoryRange<T> QueryLast(in T keySample, TimeSpan window)
+        {
+            return QueryLast(_reader.LookupInstance(keySample), window);
+        }
+
+        private static long NowNs() => (DateTime.UtcNow.Ticks - DateTime.UnixEpoch.Ticks) * 100;
+
+        // Caller holds _lock; the result carries no lease
+        private HistoryRange<T> QueryCore(DdsInstanceHandle instance, long fromNs, long toNs)
+        {
+            if (!_rings.TryGetValue(instance.Value, out var ring) || ring.Count == 0 || fromNs > toNs)
+            {
+                return default;
+            }
+
+            int lo = ring.LowerBound(fromNs);
+            int hi = ring.UpperBound(toNs);
+            return ring.Slice(lo, hi - lo);
+        }
+
+        /// <summary>
+        /// Copies the samples (and optionally their timestamps) of a time range.
+        /// Returns the number of samples copied, at most the destination length (oldest first).
+        /// </summary>
+        public int CopyRange(DdsInstanceHandle instance, long fromNs, long toNs, Span<T> samples, Span<long> timestamps = default)
+        {
+            lock (_lock)
+            {
+                var range = QueryCore(instance, fromNs, toNs);
+                int count = Math.Min(range.Count, samples.Length);
+                if (!timestamps.IsEmpty) count = Math.Min(count, timestamps.Length);
+
+                int first = Math.Min(count, range.First.Length);
+                range.First.Slice(0, first).CopyTo(samples);
+                range.Second.Slice(0, count - first).CopyTo(samples.Slice(first));
+
+                if (!timestamps.IsEmpty)
+                {
+                    range.FirstTimestamps.Slice(0, first).CopyTo(timestamps);
+                    range.SecondTimestamps.Slice(0, count - first).CopyTo(timestamps.Slice(first));
+                }
+                return count;
+            }
+        }
+
+        /// <summary>
+        /// Drops the history of an instance and frees its ring.
+        /// </summary>
+        public bool Remove(DdsInstanceHandle instance)
+        {
+            lock (_lock)
+            {
+                if (!_rings.Remove(instance.Value, out var ring)) return false;
+                Unlink(ring);
+                return true;
+            }
+        }
+
+        // Caller holds _lock
+        private Ring GetOrAddRing(long handle)
+        {
+            if (_rings.TryGetValue(handle, out var ring))
+            {
+                if (ring != _lruTail)
+                {
+                    Unlink(ring);
+                    LinkLast(ring);
+                }
+                return ring;
+            }
+
+            if (_rings.Count >= _maxInstances)
+            {
+                // Byte limit reached: recycle the ring of the least recently updated instance
+                ring = _lruHead!;
+                Unlink(ring);
+                _rings.Remove(ring.Handle);
+                ring.Clear();
+            }
+            else
+            {
+                ring = new Ring(_capacity);
+            }
+
+            ring.Handle = handle;
+            LinkLast(ring);
+            _rings[handle] = ring;
+            return ring;
+        }
+
+        private void LinkLast(Ring ring)
+        {
+            ring.Previous = _lruTail;
+            ring.Next = null;
+            if (_lruTail != null) _lruTail.Next = ring; else _lruHead = ring;
+            _lruTail = ring;
+        }
+
+        private void Unlink(Ring ring)
+        {
+            if (ring.Previous != null) ring.Previous.Next = ring.Next; else _lruHead = ring.Next;
+            if (ring.Next != null) ring.Next.Previous = ring.Previous; else _lruTail = ring.Previous;
+            ring.Previous = null;
+            ring.Next = null;
+        }
+
+        private static void Append(Ring ring, in T sample, long timestamp)
+        {
+            if (ring.Count == 0 || timestamp >= ring.TimestampAt(ring.Count - 1))
+            {
+                ring.PushBack(sample, timestamp);
+                return;
+            }
+
+            // Out of order (several writers with skewed clocks): keep the ring sorted
+            int position = ring.UpperBound(timestamp);
+            if (position == 0 && ring.Count == ring.Capacity) return; // older than everything retained
+            ring.Insert(position, sample, timestamp);
+        }
+
+        private sealed class Ring
+        {
+            private readonly T[] _values;
+            private readonly long[] _timestamps;
+            private int _head;
+
+            public Ring(int capacity)
+            {
+                _values = new T[capacity];
+                _timestamps = new long[capacity];
+            }
+
+            public int Capacity => _values.Length;
+            public int Count;
+
+            // Owning instance and LRU links; guarded by the store's lock
+            public long Handle;
+            public Ring? Previous;
+            public Ring? Next;
+
+            private int Physical(int logical)
+            {
+                int index = _head + logical;
+                return index >= _values.Length ? index - _values.Length : index;
+            }
+
+            public long TimestampAt(int logical) => _timestamps[Physical(logical)];
+
+            public void PushBack(in T sample, long timestamp)
+            {
+                if (Count == Capacity)
+                {
+                    // Overwrite the oldest
+                    _values[_head] = sample;
+                    _timestamps[_head] = timestamp;
+                    _head = Physical(1);
+                    return;
+                }
+
+                int index = Physical(Count);
+                _values[index] = sample;
+                _timestamps[index] = timestamp;
+                Count++;
+            }
+
+            public void Insert(int logical, in T sample, long timestamp)
+            {
+                if (Count == Capacity)
+                {
+                    // Drop the oldest to make room
+                    _head = Physical(1);
+                    Count--;
+                    logical--;
+                }
+
+                for (int i = Count; i > logical; i--)
+                {
+                    int to = Physical(i);
+                    int from = Physical(i - 1);
+                    _values[to] = _values[from];
+                    _timestamps[to] = _timestamps[from];
+                }
+
+                int index = Physical(logical);
+                _values[index] = sample;
+                _timestamps[index] = timestamp;
+                Count++;
+            }
+
+            // First logical index with timestamp >= value
+            public int LowerBound(long value)
+            {
+                int lo = 0, hi = Count;
+                while (lo < hi)
+                {
+                    int mid = (lo + hi) >>> 1;
+                    if (TimestampAt(mid) < value) lo = mid + 1; else hi = mid;
+                }
+                return lo;
+            }
+
+            // First logical index with timestamp > value
+            public int UpperBound(long value)
+            {
+                int lo = 0, hi = Count;
+                while (lo < hi)
+                {
+                    int mid = (lo + hi) >>> 1;
+                    if (TimestampAt(mid) <= value) lo = mid + 1; else hi = mid;
+                }
+                return lo;
+            }
+
+            public HistoryRange<T> Slice(int logical, int count)
+            {
+                if (count <= 0) return default;
+
+                int start = Physical(logical);
+                int first = Math.Min(count, Capacity - start);
+                return new HistoryRange<T>(
+                    _values.AsSpan(start, first), _timestamps.AsSpan(start, first),
+                    _values.AsSpan(0, count - first), _timestamps.AsSpan(0, count - first));
+            }
+
+            public void Clear()
+            {
+                if (RuntimeHelpers.IsReferenceOrContainsReferences<T>()) Array.Clear(_values);
+                _head = 0;
+                Count = 0;
+            }
+        }
+    }
+
+    /// <summary>
+    /// Result of a <see cref="HistoryStore{T}"/> query: up to two spans over a ring buffer, oldest first.
+    /// A non-empty range holds the store's lock; dispose it (once, on the querying thread) to release it.
+    /// </summary>
+    public readonly ref struct HistoryRange<T>
+    {
+        private readonly object? _lease;
+
+        internal HistoryRange(ReadOnlySpan<T> first, ReadOnlySpan<long> firstTimestamps,
+            ReadOnlySpan<T> second, ReadOnlySpan<long> secondTimestamps, object? lease = null)
+        {
+            First = first;
+            FirstTimestamps = firstTimestamps;
+            Second = second;
+            SecondTimestamps = secondTimestamps;
+            _lease = lease;
+        }
+
+        internal HistoryRange<T> WithLease(object lease)
+        {
+            return new HistoryRange<T>(First, FirstTimestamps, Second, SecondTimestamps, lease);
+        }
+
+        /// <summary>Releases the store's lock; the spans must not be used afterwards.</summary>
+        public void Dispose()
+        {
+            if (_lease != null) Monitor.Exit(_lease);
+        }
+
+        public ReadOnlySpan<T> First { get; }
+        public ReadOnlySpan<long> FirstTimestamps { get; }
+
+        /// <summary>Continuation after the ring wrapped; empty otherwise.</summary>
+        public ReadOnlySpan<T> Second { get; }
+        public ReadOnlySpan<long> SecondTimestamps { get; }
+
+        public int Count => First.Length + Second.Length;
+
+        public bool IsEmpty => Count == 0;
+
+        public ref readonly T this[int index] => ref index < First.Length ? ref First[index] : ref Second[index - First.Length];
+
+        /// <summary>Source timestamp (ns since the Unix epoch) of the sample at <paramref name="index"/>.</summary>
+        public long GetTimestamp(int index) => index < FirstTimestamps.Length ? FirstTimestamps[index] : SecondTimestamps[index - FirstTimestamps.Length];
+
+        public Enumerator GetEnumerator() => new Enumerator(this);
+
+        public ref struct Enumerator
+        {
+            private readonly HistoryRange<T> _range;
+            private int _index;
+
+            internal Enumerator(HistoryRange<T> range)
+            {
+                _range = range;
+                _index = -1;
+            }
+
+            public bool MoveNext() => ++_index < _range.Count;
+
+            public ref readonly T Current => ref _range[_index];
+        }
+    }
+}
@@ -0,0 +1,39 @@
+using System;
+using System.Runtime.InteropServices;
+
+namespace CycloneDDS.Runtime
+{
+    /// <summary>
+    /// Bucket hashing for the 16-byte instance digests produced by <see cref="DdsWriter{T}.ComputeInstanceDigest"/>.
+    /// </summary>
+    /// <remarks>
+    /// A digest of a small key is the big-endian CDR of the key zero-padded to 16 bytes, so most of its
+    /// bits are constant (an <c>int</c> key only occupies the top byte of the low half's native read).
+    /// Folding the halves with shifts and xors leaves the low bits at zero; both halves are run through
+    /// the MurmurHash3 64-bit finalizer instead so every key bit reaches every output bit.
+    /// </remarks>
+    internal static class InstanceDigest
+    {
+        /// <summary>Reads the two halves of a digest.</summary>
+        public static (ulong Lo, ulong Hi) Read(ReadOnlySpan<byte> digest)
+        {
+            return (MemoryMarshal.Read<ulong>(digest), MemoryMarshal.Read<ulong>(digest.Slice(8)));
+        }
+
+        /// <summary>Mixes all 128 bits of a digest into a well-distributed 64-bit hash.</summary>
+        public static ulong Mix(ulong lo, ulong hi)
+        {
+            return Finalize(lo ^ Finalize(hi ^ 0x9E3779B97F4A7C15UL));
+        }
+
+        private static ulong Finalize(ulong k)
+        {
+            k ^= k >> 33;
+            k *= 0xFF51AFD7ED558CCDUL;
+            k ^= k >> 33;
+            k *= 0xC4CEB9FE1A85EC53UL;
+            k ^= k >> 33;
+            return k;
+        }
+    }
+}
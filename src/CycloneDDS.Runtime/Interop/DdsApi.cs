@@ -1,4 +1,5 @@
 using System;
+using System.Collections.Concurrent;
 using System.Runtime.InteropServices;
 using CycloneDDS.Runtime;
 
@@ -77,6 +78,10 @@ namespace CycloneDDS.Runtime.Interop
         [DllImport(DLL_NAME)]
         public static extern void dds_lset_data_available(IntPtr listener, DdsOnDataAvailable callback);
 
+        // Unmanaged function pointer variant (UnmanagedCallersOnly), no delegate marshalling stub
+        [DllImport(DLL_NAME)]
+        public static extern void dds_lset_data_available(IntPtr listener, IntPtr callback);
+
         [DllImport(DLL_NAME, EntryPoint = "dds_set_listener")]
         public static extern int dds_reader_set_listener(DdsEntity reader, IntPtr listener);
 
@@ -127,11 +132,124 @@ namespace CycloneDDS.Runtime.Interop
             [In] ddsrt_iovec_t[] iov,
             UIntPtr size);
 
+        /// <summary>
+        /// Like <see cref="ddsi_serdata_from_ser_iov"/>, but attaches a precomputed 16-byte XTypes key hash
+        /// so the native side does not derive it from the CDR (patched export).
+        /// </summary>
+        [DllImport(DLL_NAME)]
+        public static extern unsafe IntPtr dds_serdata_from_ser_iov_keyhash(
+            IntPtr sertype,
+            int kind,
+            uint niov,
+            ddsrt_iovec_t* iov,
+            UIntPtr size,
+            byte* keyhash);
+
+        /// <summary>
+        /// Like <see cref="dds_serdata_from_ser_iov_keyhash"/>, but skips native CDR normalization (patched export).
+        /// Only for buffers produced by the generated serializer in native byte order. keyhash may be null.
+        /// </summary>
+        [DllImport(DLL_NAME)]
+        public static extern unsafe IntPtr dds_serdata_from_ser_iov_trusted(
+            IntPtr sertype,
+            int kind,
+            uint niov,
+            ddsrt_iovec_t* iov,
+            UIntPtr size,
+            byte* keyhash);
+
+        /// <summary>
+        /// Callbacks of the managed sertype (native <c>struct dds_managed_sertype_callbacks</c>).
+        /// Release: <c>void (void *context, void *buffer_handle)</c>.
+        /// KeyHash: <c>int32_t (void *context, int kind, const void *cdr, uint32_t size, unsigned char *keyhash)</c>, NULL for keyless topics.
+        /// Key: <c>int32_t (void *context, int kind, const void *cdr, uint32_t size, unsigned char *key, uint32_t max)</c>,
+        /// key-only CDR for the instance key serdata; NULL for keyless topics.
+        /// </summary>
+        [StructLayout(LayoutKind.Sequential)]
+        public struct DdsManagedSertypeCallbacks
+        {
+            public IntPtr Context;
+            public IntPtr Release;
+            public IntPtr KeyHash;
+            public IntPtr Key;
+        }
+
+        /// <summary>
+        /// Creates a topic backed by the managed sertype (patched export, see dds_managed_sertype.c).
+        /// </summary>
+        [DllImport(DLL_NAME)]
+        public static extern DdsEntity dds_create_topic_managed(
+            DdsEntity participant,
+            [MarshalAs(UnmanagedType.LPStr)] string name,
+            [MarshalAs(UnmanagedType.LPStr)] string type_name,
+            [MarshalAs(UnmanagedType.U1)] bool keyed,
+            short data_representation,
+            ref DdsManagedSertypeCallbacks callbacks,
+            IntPtr qos);
+
+        /// <summary>
+        /// Serdata referencing a managed buffer without copying (managed-sertype topics only).
+        /// On success ownership of <paramref name="buffer_handle"/> passes to the serdata and comes back
+        /// through the release callback; on failure (Zero) the caller still owns it.
+        /// </summary>
+        [DllImport(DLL_NAME)]
+        public static extern unsafe IntPtr dds_managed_serdata_create(
+            DdsEntity topic,
+            int kind,
+            IntPtr cdr,
+            uint size,
+            IntPtr buffer_handle,
+            byte* keyhash);
+
         [DllImport(DLL_NAME)]
         public static extern int dds_writecdr(
             DdsEntity writer,
             IntPtr serdata);
 
+        /// <summary>
+        /// Like <see cref="dds_writecdr"/>, but keeps the serdata's source timestamp and status info.
+        /// </summary>
+        [DllImport(DLL_NAME)]
+        public static extern int dds_forwardcdr(
+            DdsEntity writer,
+            IntPtr serdata);
+
+        /// <summary>
+        /// Sets the source timestamp of a serdata (and clears its status info) ahead of <see cref="dds_forwardcdr"/>.
+        /// Patched export.
+        /// </summary>
+        [DllImport(DLL_NAME)]
+        public static extern void dds_serdata_set_source_timestamp(IntPtr serdata, long timestamp);
+
+        [DllImport(DLL_NAME)]
+        public static extern long dds_time();
+
+        /// <summary>
+        /// Sends out data queued by write batching (no-op unless batching is enabled in the config).
+        /// </summary>
+        [DllImport(DLL_NAME)]
+        public static extern int dds_write_flush(DdsEntity writer);
+
+        /// <summary>
+        /// Blocks until all data written so far is acknowledged by every matched reliable reader.
+        /// Returns <see cref="DdsReturnCode.Timeout"/> if that did not happen within <paramref name="timeout"/> (nanoseconds).
+        /// </summary>
+        [DllImport(DLL_NAME)]
+        public static extern int dds_wait_for_acks(DdsEntity publisherOrWriter, long timeout);
+
+        /// <summary>
+        /// Sequence number of the last sample the writer wrote (patched export), for <see cref="dds_wait_for_acks_seq"/>.
+        /// </summary>
+        [DllImport(DLL_NAME)]
+        public static extern int dds_writer_last_seq(DdsEntity writer, out ulong seq);
+
+        /// <summary>
+        /// Like <see cref="dds_wait_for_acks"/>, but only for the samples up to and including <paramref name="seq"/>
+        /// (patched export), so issuing it again does not extend the wait to samples written meanwhile.
+        /// </summary>
+        [DllImport(DLL_NAME)]
+        public static extern int dds_wait_for_acks_seq(DdsEntity writer, ulong seq, long timeout);
+
         [DllImport(DLL_NAME)]
         public static extern int dds_dispose_serdata(
             DdsEntity writer,
@@ -162,6 +280,36 @@ namespace CycloneDDS.Runtime.Interop
         [DllImport(DLL_NAME)]
         public static extern long dds_lookup_instance_serdata(int entity, IntPtr serdata);
 
+        /// <summary>
+        /// Register an instance from an SDK_KEY serdata (patched export). Does not consume the serdata ref.
+        /// </summary>
+        [DllImport(DLL_NAME)]
+        public static extern int dds_register_instance_serdata(DdsEntity writer, out long handle, IntPtr serdata);
+
+        /// <summary>
+        /// Key-to-instance map entry of a key serdata, holding one reference released with
+        /// <see cref="dds_instance_tk_unref"/> (patched export). Zero on failure.
+        /// </summary>
+        [DllImport(DLL_NAME)]
+        public static extern IntPtr dds_instance_tk_ref(DdsEntity writer, IntPtr keySerdata);
+
+        /// <summary>Releases an entry from <see cref="dds_instance_tk_ref"/> (patched export).</summary>
+        [DllImport(DLL_NAME)]
+        public static extern void dds_instance_tk_unref(DdsEntity writer, IntPtr tk);
+
+        /// <summary>
+        /// Writes a serdata to the instance of <paramref name="tk"/> without the key-to-instance lookup
+        /// (patched export). Consumes the serdata ref; PRECONDITION_NOT_MET if its key is another instance's.
+        /// </summary>
+        [DllImport(DLL_NAME)]
+        public static extern int dds_write_serdata_tk(DdsEntity writer, IntPtr serdata, IntPtr tk);
+
+        [DllImport(DLL_NAME)]
+        public static extern int dds_dispose_ih(DdsEntity writer, long handle);
+
+        [DllImport(DLL_NAME)]
+        public static extern int dds_unregister_instance_ih(DdsEntity writer, long handle);
+
         [DllImport(DLL_NAME)]
         public static extern int dds_takecdr_instance(
             int reader,
@@ -180,6 +328,27 @@ namespace CycloneDDS.Runtime.Interop
             long handle,
             uint mask);
 
+        // Patched ddsc: next instance (ascending handle) with samples; state/key may be null, *key is a new reference
+        [DllImport(DLL_NAME)]
+        public static extern unsafe long dds_reader_next_instance(
+            int reader,
+            long previous,
+            uint instanceStates,
+            uint* state,
+            IntPtr* key);
+
+        // Patched ddsc: the first max instances in the given states with a handle above after, in ascending
+        // handle order, from one pass; returns the number filled or a negative return code. keys[i] are new references.
+        [DllImport(DLL_NAME)]
+        public static extern unsafe int dds_reader_collect_instances(
+            int reader,
+            uint instanceStates,
+            ulong after,
+            uint max,
+            ulong* handles,
+            uint* states,
+            IntPtr* keys);
+
         [DllImport(DLL_NAME, EntryPoint = "dds_takecdr")]
         public static extern int dds_takecdr_raw(
             int reader, 
@@ -227,6 +396,16 @@ namespace CycloneDDS.Runtime.Interop
         [DllImport(DLL_NAME, EntryPoint = "dds_serdata_to_ser")]
         public static extern void ddsi_serdata_to_ser(IntPtr serdata, UIntPtr off, UIntPtr sz, IntPtr buf);
 
+        /// <summary>
+        /// Points <paramref name="iov"/> into the serdata's serialized buffer (patched export).
+        /// Returns a new reference to release with <see cref="ddsi_serdata_to_ser_unref"/>.
+        /// </summary>
+        [DllImport(DLL_NAME, EntryPoint = "dds_serdata_to_ser_ref")]
+        public static extern IntPtr ddsi_serdata_to_ser_ref(IntPtr serdata, UIntPtr off, UIntPtr sz, out ddsrt_iovec_t iov);
+
+        [DllImport(DLL_NAME, EntryPoint = "dds_serdata_to_ser_unref")]
+        public static extern void ddsi_serdata_to_ser_unref(IntPtr serdata, in ddsrt_iovec_t iov);
+
         // Opaque struct for type safety in unsafe code
         public struct struct_ddsi_serdata { }
 
@@ -250,6 +429,69 @@ namespace CycloneDDS.Runtime.Interop
             return ddsi_serdata_from_ser_iov(sertype, kind, 1, new[] { iov }, (UIntPtr)size);
         }
 
+        public static unsafe IntPtr dds_create_serdata_from_cdr(DdsEntity topic, IntPtr data, uint size, int kind, ReadOnlySpan<byte> keyHash)
+        {
+            IntPtr sertype = dds_get_topic_sertype(topic);
+            if (sertype == IntPtr.Zero) return IntPtr.Zero;
+
+            var iov = new ddsrt_iovec_t
+            {
+                iov_base = data,
+                iov_len = (UIntPtr)size
+            };
+
+            fixed (byte* kh = keyHash)
+            {
+                return dds_serdata_from_ser_iov_keyhash(sertype, kind, 1, &iov, (UIntPtr)size, kh);
+            }
+        }
+
+        /// <summary>
+        /// Serdata from trusted CDR (no normalization). An empty <paramref name="keyHash"/> attaches no key hash.
+        /// </summary>
+        public static unsafe IntPtr dds_create_serdata_from_cdr_trusted(DdsEntity topic, IntPtr data, uint size, int kind, ReadOnlySpan<byte> keyHash)
+        {
+            IntPtr sertype = dds_get_topic_sertype(topic);
+            if (sertype == IntPtr.Zero) return IntPtr.Zero;
+
+            var iov = new ddsrt_iovec_t
+            {
+                iov_base = data,
+                iov_len = (UIntPtr)size
+            };
+
+            fixed (byte* kh = keyHash)
+            {
+                return dds_serdata_from_ser_iov_trusted(sertype, kind, 1, &iov, (UIntPtr)size, kh);
+            }
+        }
+
+        private static readonly ConcurrentDictionary<string, bool> _exports = new();
+
+        /// <summary>
+        /// True if the loaded ddsc exports <paramref name="name"/>.
+        /// Used to detect optional patched entry points; the result is cached.
+        /// </summary>
+        public static bool HasExport(string name)
+        {
+            return _exports.GetOrAdd(name, static n =>
+                NativeLibrary.TryLoad(DLL_NAME, typeof(DdsApi).Assembly, null, out IntPtr lib) &&
+                NativeLibrary.TryGetExport(lib, n, out _));
+        }
+
+        /// <summary>
+        /// Throws <see cref="NotSupportedException"/> unless the loaded ddsc exports the patched entry point
+        /// <paramref name="name"/>, instead of failing later with <see cref="EntryPointNotFoundException"/>.
+        /// </summary>
+        public static void RequireExport(string name)
+        {
+            if (!HasExport(name))
+            {
+                throw new NotSupportedException(
+                    $"The loaded ddsc does not export {name}; build it with the patches in docs/ddsc-serdata-api-exposing.md.");
+            }
+        }
+
         [DllImport(DLL_NAME)]
         public static extern void dds_free(IntPtr ptr);
 
@@ -0,0 +1,436 @@
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Linq.Expressions;
+using System.Reflection;
+using System.Threading;
+using System.Threading.Tasks;
+
+namespace CycloneDDS.Runtime
+{
+    /// <summary>
+    /// Latest value of an instance held by a <see cref="LastValueCache{TKey, TView}"/>.
+    /// </summary>
+    public readonly struct LastValueEntry<TKey, TView>
+    {
+        internal LastValueEntry(TKey key, TView value, DdsInstanceState state, long sourceTimestamp)
+        {
+            Key = key;
+            Value = value;
+            State = state;
+            SourceTimestamp = sourceTimestamp;
+        }
+
+        public TKey Key { get; }
+
+        /// <summary>Last valid sample; kept after the instance is disposed or loses its writers.</summary>
+        public TView Value { get; }
+
+        public DdsInstanceState State { get; }
+
+        /// <summary>Source timestamp (ns) of the last sample or state change.</summary>
+        public long SourceTimestamp { get; }
+    }
+
+    /// <summary>
+    /// "Latest value per key" view of a topic. Feed it with <see cref="Poll{T}"/>, <see cref="RunAsync{T}"/>,
+    /// <see cref="Apply"/> or <see cref="Update"/> (feeds are serialized); any number of threads can read it concurrently.
+    /// </summary>
+    /// <remarks>
+    /// <para>
+    /// Entries live in an open-addressing table and are overwritten in place, so updates of known instances
+    /// do not allocate. Each slot carries a sequence counter: readers copy the value and retry if the feeder
+    /// wrote the slot meanwhile, so reads take no lock and never see a torn value.
+    /// When the table grows, readers still holding the old table may briefly see the value from before the growth.
+    /// </para>
+    /// <para>
+    /// Entries stay until <see cref="Remove"/> or <see cref="RemoveNotAlive"/> drops them. A removed slot is left as a
+    /// tombstone (never reused for another key, so a concurrent reader cannot mix two keys) until the table is rebuilt.
+    /// The instance-handle mapping used for state-only samples is dropped when an instance loses its writers.
+    /// </para>
+    /// <para>
+    /// Without an explicit key selector the key is taken from the generated <c>GetKeyDescriptors</c> of
+    /// <typeparamref name="TView"/>: <typeparamref name="TKey"/> must be the type of the single key member,
+    /// or a value tuple of the key members in key order.
+    /// </para>
+    /// </remarks>
+    public sealed class LastValueCache<TKey, TView> where TKey : notnull where TView : struct
+    {
+        private static readonly Func<TView, TKey>? _generatedKeySelector = CreateKeySelector();
+
+        private readonly Func<TView, TKey> _keySelector;
+        private readonly IEqualityComparer<TKey> _comparer;
+        private readonly object _feedLock = new object();
+
+        // Feeder-side only: instance handle to key, for dispose/unregister notifications without data
+        private readonly Dictionary<long, TKey> _handles = new();
+
+        private const int SlotFree = 0;
+        private const int SlotUsed = 1;
+        private const int SlotRemoved = 2;
+
+        private volatile Table _table;
+        private int _count;
+        private int _removed; // tombstones in _table; feeder-side only
+
+        /// <param name="capacity">Initial number of instances (the table grows as needed).</param>
+        /// <param name="keySelector">Key extraction; defaults to the generated key members.</param>
+        /// <param name="comparer">Key equality; defaults to <see cref="EqualityComparer{T}.Default"/>.</param>
+        /// <exception cref="ArgumentException">No key selector given and <typeparamref name="TKey"/> does not match the generated key members.</exception>
+        public LastValueCache(int capacity = 1024, Func<TView, TKey>? keySelector = null, IEqualityComparer<TKey>? comparer = null)
+        {
+            if (capacity <= 0) throw new ArgumentOutOfRangeException(nameof(capacity));
+
+            _keySelector = keySelector ?? _generatedKeySelector ?? throw new ArgumentException(
+                $"{typeof(TKey).Name} does not match the [DdsKey] members of {typeof(TView).Name}; pass a key selector.", nameof(keySelector));
+            _comparer = comparer ?? EqualityComparer<TKey>.Default;
+
+            int size = 2;
+            while (size < capacity * 2) size <<= 1;
+            _table = new Table(size);
+        }
+
+        /// <summary>Number of instances held.</summary>
+        public int Count => Volatile.Read(ref _count);
+
+        /// <summary>
+        /// Latest valid value of <paramref name="key"/>. Lock-free; callable from any thread.
+        /// </summary>
+        public bool TryGetValue(in TKey key, out TView value)
+        {
+            return TryGetValue(key, out value, out _);
+        }
+
+        /// <summary>
+        /// Latest valid value and instance state of <paramref name="key"/>.
+        /// </summary>
+        public bool TryGetValue(in TKey key, out TView value, out DdsInstanceState state)
+        {
+            var table = _table;
+            int index = Find(table, key, Hash(key));
+            if (index < 0)
+            {
+                value = default;
+                state = default;
+                return false;
+            }
+
+            table.ReadSlot(index, out value, out state, out _);
+            return true;
+        }
+
+        /// <summary>
+        /// Copies the current entries into a list (allocates the list entries only).
+        /// </summary>
+        public List<LastValueEntry<TKey, TView>> Snapshot()
+        {
+            var result = new List<LastValueEntry<TKey, TView>>(Count);
+            var table = _table;
+            for (int i = 0; i < table.Keys.Length; i++)
+            {
+                if (Volatile.Read(ref table.Used[i]) != SlotUsed) continue;
+                table.ReadSlot(i, out var value, out var state, out long timestamp);
+                result.Add(new LastValueEntry<TKey, TView>(table.Keys[i], value, state, timestamp));
+            }
+            return result;
+        }
+
+        /// <summary>
+        /// Takes up to <paramref name="maxSamples"/> samples from <paramref name="reader"/> and applies them.
+        /// Returns the number of samples taken.
+        /// </summary>
+        public int Poll<T>(DdsReader<T, TView> reader, int maxSamples = 256)
+        {
+            if (reader == null) throw new ArgumentNullException(nameof(reader));
+
+            using var scope = reader.Take(maxSamples);
+            Apply(scope);
+            return scope.Count;
+        }
+
+        /// <summary>
+        /// Feeds the cache from <paramref name="reader"/> until cancelled.
+        /// </summary>
+        public async Task RunAsync<T>(DdsReader<T, TView> reader, CancellationToken cancellationToken = default)
+        {
+            if (reader == null) throw new ArgumentNullException(nameof(reader));
+
+            while (!cancellationToken.IsCancellationRequested)
+            {
+                while (Poll(reader) > 0) { }
+                await reader.WaitDataAsync(cancellationToken).ConfigureAwait(false);
+            }
+        }
+
+        /// <summary>
+        /// Applies taken or read samples. Samples without data only update the instance state.
+        /// </summary>
+        public void Apply(ViewScope<TView> scope)
+        {
+            var infos = scope.Infos;
+            lock (_feedLock)
+            {
+                for (int i = 0; i < scope.Count; i++)
+                {
+                    ref readonly var info = ref infos[i];
+
+                    if (info.ValidData != 0)
+                    {
+                        var view = scope[i];
+                        var key = _keySelector(view);
+                        _handles.TryAdd(info.InstanceHandle, key);
+                        Store(key, info.InstanceHandle, view, hasValue: true, info.InstanceState, info.SourceTimestamp);
+                    }
+                    else if (_handles.TryGetValue(info.InstanceHandle, out var known))
+                    {
+                        Store(known, info.InstanceHandle, default, hasValue: false, info.InstanceState, info.SourceTimestamp);
+                    }
+                }
+            }
+        }
+
+        /// <summary>
+        /// Stores a sample as the latest value of its key (instance state <see cref="DdsInstanceState.Alive"/>),
+        /// e.g. to seed the cache from a recording.
+        /// </summary>
+        public void Update(in TView sample, long sourceTimestamp = 0)
+        {
+            lock (_feedLock)
+            {
+                Store(_keySelector(sample), 0, sample, hasValue: true, DdsInstanceState.Alive, sourceTimestamp);
+            }
+        }
+
+        /// <summary>
+        /// Drops the entry of <paramref name="key"/>. Returns false if it was not cached.
+        /// A later sample of the instance adds it again.
+        /// </summary>
+        public bool Remove(in TKey key)
+        {
+            lock (_feedLock)
+            {
+                var table = _table;
+                int index = Find(table, key, Hash(key));
+                if (index < 0) return false;
+
+                RemoveAt(table, index);
+                return true;
+            }
+        }
+
+        /// <summary>
+        /// Drops every entry whose instance is disposed or has no writers, and returns how many were dropped.
+        /// </summary>
+        public int RemoveNotAlive()
+        {
+            lock (_feedLock)
+            {
+                var table = _table;
+                int removed = 0;
+                for (int i = 0; i < table.Keys.Length; i++)
+                {
+                    // Only the feeder writes slots, so no version check is needed under _feedLock
+                    if (table.Used[i] != SlotUsed || table.Slots[i].State == DdsInstanceState.Alive) continue;
+
+                    RemoveAt(table, i);
+                    removed++;
+                }
+                return removed;
+            }
+        }
+
+        // Caller holds _feedLock
+        private void RemoveAt(Table table, int index)
+        {
+            if (table.Handles[index] != 0) _handles.Remove(table.Handles[index]);
+            table.Handles[index] = 0;
+
+            // Tombstone: Find probes past it; the key stays for readers comparing it right now
+            Volatile.Write(ref table.Used[index], SlotRemoved);
+            Interlocked.Decrement(ref _count);
+            _removed++;
+        }
+
+        // Caller holds _feedLock; handle is 0 when the sample did not come from a reader
+        private void Store(TKey key, long handle, TView value, bool hasValue, DdsInstanceState state, long timestamp)
+        {
+            if (state == DdsInstanceState.NotAliveNoWriters && handle != 0)
+            {
+                // Only a new writer brings the instance back, and that comes with data (and the handle) again
+                _handles.Remove(handle);
+                handle = 0;
+            }
+
+            int hash = Hash(key);
+            var table = _table;
+            int index = Find(table, key, hash);
+
+            if (index < 0)
+            {
+                if (!hasValue) return;
+
+                if ((_count + _removed + 1) * 10 > table.Keys.Length * 7)
+                {
+                    table = Rebuild(table);
+                }
+
+                index = hash & table.Mask;
+                while (table.Used[index] != SlotFree) index = (index + 1) & table.Mask;
+
+                table.Keys[index] = key;
+                table.Handles[index] = handle;
+                table.WriteSlot(index, value, state, timestamp);
+                Volatile.Write(ref table.Used[index], SlotUsed); // publishes the key and first value
+                Interlocked.Increment(ref _count);
+                return;
+            }
+
+            if (handle != 0 || state == DdsInstanceState.NotAliveNoWriters) table.Handles[index] = handle;
+
+            if (hasValue)
+            {
+                table.WriteSlot(index, value, state, timestamp);
+            }
+            else
+            {
+                table.ReadSlot(index, out var last, out _, out _);
+                table.WriteSlot(index, last, state, timestamp);
+            }
+        }
+
+        // Copies the live entries into a new table, doubling it unless tombstones took most of the room
+        private Table Rebuild(Table old)
+        {
+            int size = (_count + 1) * 20 > old.Keys.Length * 7 ? old.Keys.Length * 2 : old.Keys.Length;
+            var table = new Table(size);
+            for (int i = 0; i < old.Keys.Length; i++)
+            {
+                if (old.Used[i] != SlotUsed) continue;
+
+                int index = Hash(old.Keys[i]) & table.Mask;
+                while (table.Used[index] != SlotFree) index = (index + 1) & table.Mask;
+
+                table.Keys[index] = old.Keys[i];
+                table.Handles[index] = old.Handles[i];
+                old.ReadSlot(i, out var value, out var state, out long timestamp);
+                table.WriteSlot(index, value, state, timestamp);
+                table.Used[index] = SlotUsed;
+            }
+
+            _removed = 0;
+            _table = table; // volatile: readers pick up a fully built table
+            return table;
+        }
+
+        private int Find(Table table, in TKey key, int hash)
+        {
+            int index = hash & table.Mask;
+            for (int probe = 0; probe < table.Keys.Length; probe++)
+            {
+                int used = Volatile.Read(ref table.Used[index]);
+                if (used == SlotFree) return -1;
+                if (used == SlotUsed && _comparer.Equals(table.Keys[index], key)) return index;
+                index = (index + 1) & table.Mask;
+            }
+            return -1;
+        }
+
+        private int Hash(in TKey key)
+        {
+            // Spread the low bits; many key hash codes are small sequential integers
+            uint h = (uint)_comparer.GetHashCode(key);
+            h ^= h >> 16;
+            h *= 0x7feb352d;
+            h ^= h >> 15;
+            return (int)(h & 0x7fffffff);
+        }
+
+        private static Func<TView, TKey>? CreateKeySelector()
+        {
+            var keys = DdsTypeSupport.GetKeyDescriptors<TView>();
+            if (keys == null || keys.Length == 0) return null;
+
+            var view = Expression.Parameter(typeof(TView), "view");
+            var members = new List<Expression>();
+            foreach (var key in keys.OrderBy(k => k.Index))
+            {
+                var member = (MemberInfo?)typeof(TView).GetField(key.Name) ?? typeof(TView).GetProperty(key.Name);
+                if (member == null) return null; // nested key member; needs an explicit selector
+                members.Add(Expression.MakeMemberAccess(view, member));
+            }
+
+            Expression body;
+            if (members.Count == 1 && members[0].Type == typeof(TKey))
+            {
+                body = members[0];
+            }
+            else
+            {
+                var types = members.Select(m => m.Type).ToArray();
+                var ctor = typeof(TKey).GetConstructor(types);
+                if (ctor == null || !typeof(TKey).FullName!.StartsWith("System.ValueTuple`", StringComparison.Ordinal)) return null;
+                body = Expression.New(ctor, members);
+            }
+
+            return Expression.Lambda<Func<TView, TKey>>(body, view).Compile();
+        }
+
+        private sealed class Table
+        {
+            public readonly TKey[] Keys;
+            public readonly long[] Handles; // feeder-side only
+            public readonly int[] Used;
+            public readonly Slot[] Slots;
+            public readonly int Mask;
+
+            public Table(int size)
+            {
+                Keys = new TKey[size];
+                Handles = new long[size];
+                Used = new int[size];
+                Slots = new Slot[size];
+                Mask = size - 1;
+            }
+
+            // Single writer (feeder) per slot
+            public void WriteSlot(int index, in TView value, DdsInstanceState state, long timestamp)
+            {
+                ref var slot = ref Slots[index];
+                int version = slot.Version;
+                Interlocked.Exchange(ref slot.Version, version + 1); // odd: write in progress; full fence
+                slot.Value = value;
+                slot.State = state;
+                slot.SourceTimestamp = timestamp;
+                Volatile.Write(ref slot.Version, version + 2);
+            }
+
+            public void ReadSlot(int index, out TView value, out DdsInstanceState state, out long timestamp)
+            {
+                ref var slot = ref Slots[index];
+                var spinner = new SpinWait();
+                while (true)
+                {
+                    int before = Volatile.Read(ref slot.Version);
+                    if ((before & 1) == 0)
+                    {
+                        value = slot.Value;
+                        state = slot.State;
+                        timestamp = slot.SourceTimestamp;
+
+                        Interlocked.MemoryBarrier(); // keep the copy before the re-check
+                        if (Volatile.Read(ref slot.Version) == before) return;
+                    }
+                    spinner.SpinOnce();
+                }
+            }
+        }
+
+        private struct Slot
+        {
+            public int Version;
+            public DdsInstanceState State;
+            public long SourceTimestamp;
+            public TView Value;
+        }
+    }
+}
@@ -0,0 +1,63 @@
+using System;
+using System.Threading;
+using System.Threading.Channels;
+using System.Threading.Tasks;
+
+namespace CycloneDDS.Runtime
+{
+    /// <summary>
+    /// Consumer side of the channel returned by <see cref="DdsReader{T, TView}.OpenChannel"/>.
+    /// Samples are written by the listener thread; with <see cref="BoundedChannelFullMode.Wait"/> the
+    /// listener leaves what does not fit in the reader cache, and this reader pulls it in once drained.
+    /// </summary>
+    internal sealed class ListenerChannelReader<TView> : ChannelReader<TView> where TView : struct
+    {
+        private readonly Channel<TView> _channel;
+        private readonly Action _refill;
+
+        // Raised by a Wait-mode fill before it checks for room and cleared once the reader cache is drained,
+        // so a consumer that empties the channel meanwhile knows to refill
+        internal volatile bool Backlog;
+
+        internal ListenerChannelReader(Channel<TView> channel, int capacity, BoundedChannelFullMode fullMode, Action refill)
+        {
+            _channel = channel;
+            _refill = refill;
+            Capacity = capacity;
+            FullMode = fullMode;
+        }
+
+        internal int Capacity { get; }
+        internal BoundedChannelFullMode FullMode { get; }
+        internal ChannelWriter<TView> Writer => _channel.Writer;
+
+        public override Task Completion => _channel.Reader.Completion;
+        public override bool CanCount => true;
+        public override bool CanPeek => true;
+        public override int Count => _channel.Reader.Count;
+
+        public override bool TryRead(out TView item)
+        {
+            if (_channel.Reader.TryRead(out item)) return true;
+            if (!Backlog) return false;
+
+            _refill();
+            return _channel.Reader.TryRead(out item);
+        }
+
+        public override bool TryPeek(out TView item)
+        {
+            if (_channel.Reader.TryPeek(out item)) return true;
+            if (!Backlog) return false;
+
+            _refill();
+            return _channel.Reader.TryPeek(out item);
+        }
+
+        public override ValueTask<bool> WaitToReadAsync(CancellationToken cancellationToken = default)
+        {
+            if (Backlog && _channel.Reader.Count == 0) _refill();
+            return _channel.Reader.WaitToReadAsync(cancellationToken);
+        }
+    }
+}
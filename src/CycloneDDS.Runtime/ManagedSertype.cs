@@ -0,0 +1,198 @@
+using System;
+using System.Reflection;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+using System.Threading;
+using CycloneDDS.Core;
+using CycloneDDS.Runtime.Interop;
+using CycloneDDS.Runtime.Memory;
+
+namespace CycloneDDS.Runtime
+{
+    /// <summary>
+    /// Non-generic view of a topic type for the native managed-sertype callbacks.
+    /// </summary>
+    internal interface IManagedTypeSupport
+    {
+        /// <summary>
+        /// Computes the key hash of a CDR buffer (encapsulation header included).
+        /// <paramref name="kind"/> is the serdata kind: 1 = key-only CDR, 2 = full sample.
+        /// </summary>
+        void ComputeKeyHash(int kind, ReadOnlySpan<byte> cdr, Span<byte> hash16);
+
+        /// <summary>
+        /// Writes the key-only CDR of a CDR buffer into <paramref name="key"/> and returns its size.
+        /// A size above the span's length means nothing was written.
+        /// </summary>
+        int SerializeKey(int kind, ReadOnlySpan<byte> cdr, Span<byte> key);
+    }
+
+    internal sealed class ManagedTypeSupport<T> : IManagedTypeSupport
+    {
+        private delegate T DeserializeDelegate(ref CdrReader reader);
+        private delegate T ReadKeySampleDelegate(ref CdrReader reader, bool skipToEnd);
+
+        private static readonly DeserializeDelegate? _deserialize = CreateDeserializer("Deserialize");
+        private static readonly DeserializeDelegate? _deserializeKey = CreateDeserializer("DeserializeKey");
+        private static readonly ReadKeySampleDelegate? _readKeySample = CreateKeySampleReader();
+
+        public static readonly ManagedTypeSupport<T> Instance = new();
+
+        /// <summary>True if the type has no key, or has every generated method the key callback needs.</summary>
+        public static bool IsSupported =>
+            !IsKeyed || (DdsKeySerializer<T>.KeyHasher != null && _deserialize != null && _deserializeKey != null);
+
+        public static bool IsKeyed => DdsKeySerializer<T>.Serializer != null;
+
+        /// <summary>True if instance key serdata can carry the key-only CDR (generated key sizer present).</summary>
+        public static bool CanSerializeKey => IsKeyed && DdsKeySerializer<T>.Sizer != null;
+
+        public void ComputeKeyHash(int kind, ReadOnlySpan<byte> cdr, Span<byte> hash16)
+        {
+            T sample = ReadKey(kind, cdr, out _);
+            DdsKeySerializer<T>.KeyHasher!(sample, hash16);
+        }
+
+        public int SerializeKey(int kind, ReadOnlySpan<byte> cdr, Span<byte> key)
+        {
+            T sample = ReadKey(kind, cdr, out CdrEncoding encoding);
+
+            // Same layout as the writer's SDK_KEY serdata, in the encoding the sample came in
+            int origin = encoding == CdrEncoding.Xcdr2 ? 0 : 4;
+            int size = DdsKeySerializer<T>.Sizer!(sample, 4 + origin, encoding) + 4;
+            if (size > key.Length) return size;
+
+            var writer = new CdrWriter(key.Slice(0, size), encoding, origin: origin);
+            DdsWriter<T>.WriteEncapsulationHeader(ref writer, encoding);
+            DdsKeySerializer<T>.Serializer!(sample, ref writer);
+            writer.Complete();
+            return writer.Position;
+        }
+
+        private static T ReadKey(int kind, ReadOnlySpan<byte> cdr, out CdrEncoding encoding)
+        {
+            // Same encoding detection as ViewScope: XCDR2 identifiers are 0x06..0x0D
+            encoding = cdr.Length >= 2 && cdr[1] >= 6 ? CdrEncoding.Xcdr2 : CdrEncoding.Xcdr1;
+            int origin = encoding == CdrEncoding.Xcdr2 ? 0 : 4;
+
+            var reader = new CdrReader(cdr, encoding, origin: origin);
+            reader.ReadInt32(); // encapsulation header
+
+            // Full samples arrive on the receive thread: decode only up to the key members when the
+            // generated ReadKeySample exists, instead of materializing strings and sequences
+            return kind == 1 ? _deserializeKey!(ref reader)
+                : _readKeySample != null ? _readKeySample(ref reader, false)
+                : _deserialize!(ref reader);
+        }
+
+        private static ReadKeySampleDelegate? CreateKeySampleReader()
+        {
+            var method = typeof(T).GetMethod("ReadKeySample", BindingFlags.Public | BindingFlags.Static,
+                new[] { typeof(CdrReader).MakeByRefType(), typeof(bool) });
+            return method == null || method.ReturnType != typeof(T)
+                ? null
+                : (ReadKeySampleDelegate)Delegate.CreateDelegate(typeof(ReadKeySampleDelegate), method);
+        }
+
+        private static DeserializeDelegate? CreateDeserializer(string name)
+        {
+            var method = typeof(T).GetMethod(name, BindingFlags.Public | BindingFlags.Static, new[] { typeof(CdrReader).MakeByRefType() });
+            return method == null ? null : (DeserializeDelegate)Delegate.CreateDelegate(typeof(DeserializeDelegate), method);
+        }
+    }
+
+    /// <summary>
+    /// Native callbacks of the managed sertype (<c>dds_managed_sertype.c</c>).
+    /// Written samples are serialized into arena buffers that the serdata references directly;
+    /// the buffer is pinned through a GCHandle and returned to the arena when Cyclone frees the serdata.
+    /// </summary>
+    internal static unsafe class ManagedSertype
+    {
+        // One context per type for the process lifetime: Cyclone may keep a sertype
+        // (and call back into it) after the topic entity that created it is deleted.
+        private static class Context<T>
+        {
+            public static readonly IntPtr Handle = GCHandle.ToIntPtr(GCHandle.Alloc(ManagedTypeSupport<T>.Instance));
+        }
+
+        /// <summary>
+        /// Callback table for a topic type.
+        /// </summary>
+        public static DdsApi.DdsManagedSertypeCallbacks CreateCallbacks<T>()
+        {
+            return new DdsApi.DdsManagedSertypeCallbacks
+            {
+                Context = Context<T>.Handle,
+                Release = (IntPtr)(delegate* unmanaged[Cdecl]<IntPtr, IntPtr, void>)&Release,
+                KeyHash = ManagedTypeSupport<T>.IsKeyed
+                    ? (IntPtr)(delegate* unmanaged[Cdecl]<IntPtr, int, byte*, uint, byte*, int>)&KeyHash
+                    : IntPtr.Zero,
+                Key = ManagedTypeSupport<T>.CanSerializeKey
+                    ? (IntPtr)(delegate* unmanaged[Cdecl]<IntPtr, int, byte*, uint, byte*, uint, int>)&SerializeKey
+                    : IntPtr.Zero
+            };
+        }
+
+        /// <summary>
+        /// Pins an arena buffer for a serdata. Pass the result as <c>buffer_handle</c>.
+        /// </summary>
+        public static IntPtr PinBuffer(byte[] buffer) => GCHandle.ToIntPtr(GCHandle.Alloc(buffer, GCHandleType.Pinned));
+
+        /// <summary>
+        /// Undoes <see cref="PinBuffer"/> when the serdata could not be created.
+        /// </summary>
+        public static void ReleaseBuffer(IntPtr bufferHandle)
+        {
+            var handle = GCHandle.FromIntPtr(bufferHandle);
+            var buffer = (byte[])handle.Target!;
+            handle.Free();
+            Arena.Return(buffer);
+        }
+
+        [UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvCdecl) })]
+        private static void Release(IntPtr context, IntPtr bufferHandle)
+        {
+            ReleaseBuffer(bufferHandle);
+        }
+
+        private static long _keyHashFailures;
+
+        /// <summary>
+        /// Samples dropped because their key hash could not be computed (malformed CDR).
+        /// </summary>
+        public static long KeyHashFailures => Interlocked.Read(ref _keyHashFailures);
+
+        [UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvCdecl) })]
+        private static int KeyHash(IntPtr context, int kind, byte* cdr, uint size, byte* keyhash)
+        {
+            // Exceptions must not cross into native code; a negative result makes Cyclone drop the sample.
+            // This runs on the delivery path, so failures are only counted.
+            try
+            {
+                var support = (IManagedTypeSupport)GCHandle.FromIntPtr(context).Target!;
+                support.ComputeKeyHash(kind, new ReadOnlySpan<byte>(cdr, (int)size), new Span<byte>(keyhash, KeyHashWriter.HashSize));
+                return 0;
+            }
+            catch
+            {
+                Interlocked.Increment(ref _keyHashFailures);
+                return -1;
+            }
+        }
+
+        [UnmanagedCallersOnly(CallConvs = new[] { typeof(CallConvCdecl) })]
+        private static int SerializeKey(IntPtr context, int kind, byte* cdr, uint size, byte* key, uint max)
+        {
+            // Runs once per new instance; on failure the instance only lacks a decodable key in GetInstances
+            try
+            {
+                var support = (IManagedTypeSupport)GCHandle.FromIntPtr(context).Target!;
+                return support.SerializeKey(kind, new ReadOnlySpan<byte>(cdr, (int)size), new Span<byte>(key, (int)max));
+            }
+            catch
+            {
+                return -1;
+            }
+        }
+    }
+}
@@ -0,0 +1,107 @@
+using System;
+using System.Threading;
+
+namespace CycloneDDS.Runtime.Memory
+{
+    /// <summary>
+    /// Preallocated bounded queue (Vyukov): each cell carries a sequence number, so enqueue and
+    /// dequeue are a compare-and-swap on their position plus a copy of the item. Safe for any number
+    /// of producers and consumers; items are stored by value and never allocate.
+    /// </summary>
+    internal sealed class BoundedRingQueue<T>
+    {
+        private readonly T[] _items;
+        private readonly long[] _sequence;
+        private readonly int _mask;
+
+        private long _enqueuePos;
+        private long _dequeuePos;
+
+        public BoundedRingQueue(int capacity)
+        {
+            if (capacity <= 0) throw new ArgumentOutOfRangeException(nameof(capacity));
+
+            int size = 2;
+            while (size < capacity) size <<= 1;
+            _mask = size - 1;
+
+            _items = new T[size];
+            _sequence = new long[size];
+            for (int i = 0; i < size; i++) _sequence[i] = i;
+        }
+
+        public int Capacity => _mask + 1;
+
+        /// <summary>Approximate number of queued items.</summary>
+        public int Count
+        {
+            get
+            {
+                long count = Volatile.Read(ref _enqueuePos) - Volatile.Read(ref _dequeuePos);
+                return count < 0 ? 0 : (int)Math.Min(count, Capacity);
+            }
+        }
+
+        public bool TryEnqueue(in T item)
+        {
+            long pos = Volatile.Read(ref _enqueuePos);
+            while (true)
+            {
+                int index = (int)(pos & _mask);
+                long diff = Volatile.Read(ref _sequence[index]) - pos;
+
+                if (diff == 0)
+                {
+                    long observed = Interlocked.CompareExchange(ref _enqueuePos, pos + 1, pos);
+                    if (observed == pos)
+                    {
+                        _items[index] = item;
+                        Volatile.Write(ref _sequence[index], pos + 1);
+                        return true;
+                    }
+                    pos = observed;
+                }
+                else if (diff < 0)
+                {
+                    return false; // full
+                }
+                else
+                {
+                    pos = Volatile.Read(ref _enqueuePos);
+                }
+            }
+        }
+
+        public bool TryDequeue(out T item)
+        {
+            long pos = Volatile.Read(ref _dequeuePos);
+            while (true)
+            {
+                int index = (int)(pos & _mask);
+                long diff = Volatile.Read(ref _sequence[index]) - (pos + 1);
+
+                if (diff == 0)
+                {
+                    long observed = Interlocked.CompareExchange(ref _dequeuePos, pos + 1, pos);
+                    if (observed == pos)
+                    {
+                        item = _items[index];
+                        _items[index] = default!; // release references held by the slot
+                        Volatile.Write(ref _sequence[index], pos + _mask + 1);
+                        return true;
+                    }
+                    pos = observed;
+                }
+                else if (diff < 0)
+                {
+                    item = default!;
+                    return false; // empty
+                }
+                else
+                {
+                    pos = Volatile.Read(ref _dequeuePos);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,51 @@
+using System;
+using System.Threading;
+
+namespace CycloneDDS.Runtime.Memory
+{
+    /// <summary>
+    /// Park/wake handshake between producers and the single consumer thread draining a lock-free queue.
+    /// The consumer only sleeps after raising an idle flag and re-checking the queue; producers only pay
+    /// for setting the event when that flag is raised.
+    /// </summary>
+    /// <remarks>
+    /// Both sides follow the store-then-load pattern: the consumer raises the flag and then reads the
+    /// queue, a producer publishes its item and then reads the flag. A full fence on each side is what
+    /// keeps them from both reading the stale value (the consumer seeing an empty queue while the
+    /// producer sees a busy consumer), which would leave the item queued until the next wake.
+    /// </remarks>
+    internal sealed class ParkingSignal : IDisposable
+    {
+        private readonly ManualResetEventSlim _signal = new ManualResetEventSlim(false);
+        private int _idle;
+
+        /// <summary>
+        /// Producer side, after publishing an item: wakes the consumer if it is parked or about to park.
+        /// </summary>
+        public void Wake()
+        {
+            Interlocked.MemoryBarrier(); // order the publish before reading _idle
+            if (Volatile.Read(ref _idle) != 0) _signal.Set();
+        }
+
+        /// <summary>
+        /// Consumer side, after finding nothing to do: sleeps until <see cref="Wake"/> or <see cref="Release"/>
+        /// unless <paramref name="canSleep"/> reports work that arrived meanwhile.
+        /// </summary>
+        public void Park<TState>(TState state, Func<TState, bool> canSleep)
+        {
+            _signal.Reset();
+            Interlocked.Exchange(ref _idle, 1); // full fence before the re-check
+            if (canSleep(state))
+            {
+                _signal.Wait();
+            }
+            Volatile.Write(ref _idle, 0);
+        }
+
+        /// <summary>Unconditionally wakes the consumer, e.g. to let it observe a stop request.</summary>
+        public void Release() => _signal.Set();
+
+        public void Dispose() => _signal.Dispose();
+    }
+}
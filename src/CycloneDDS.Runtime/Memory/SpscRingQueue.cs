@@ -0,0 +1,69 @@
+using System;
+using System.Runtime.InteropServices;
+using System.Threading;
+
+namespace CycloneDDS.Runtime.Memory
+{
+    /// <summary>
+    /// Preallocated bounded queue for exactly one producer and one consumer thread. Each side owns
+    /// its position and only reads the other's, so enqueue and dequeue are a copy plus a release store.
+    /// </summary>
+    internal sealed class SpscRingQueue<T>
+    {
+        private readonly T[] _items;
+        private readonly int _mask;
+
+        // Producer and consumer positions on separate cache lines
+        private PaddedPosition _tail;
+        private PaddedPosition _head;
+
+        public SpscRingQueue(int capacity)
+        {
+            if (capacity <= 0) throw new ArgumentOutOfRangeException(nameof(capacity));
+
+            int size = 2;
+            while (size < capacity) size <<= 1;
+            _mask = size - 1;
+            _items = new T[size];
+        }
+
+        public int Capacity => _mask + 1;
+
+        /// <summary>Approximate number of queued items.</summary>
+        public int Count => (int)(Volatile.Read(ref _tail.Value) - Volatile.Read(ref _head.Value));
+
+        /// <summary>Producer side. False when the queue is full.</summary>
+        public bool TryEnqueue(in T item)
+        {
+            long tail = _tail.Value;
+            if (tail - Volatile.Read(ref _head.Value) > _mask) return false;
+
+            _items[tail & _mask] = item;
+            Volatile.Write(ref _tail.Value, tail + 1); // publishes the item
+            return true;
+        }
+
+        /// <summary>Consumer side. False when the queue is empty.</summary>
+        public bool TryDequeue(out T item)
+        {
+            long head = _head.Value;
+            if (head == Volatile.Read(ref _tail.Value))
+            {
+                item = default!;
+                return false;
+            }
+
+            int index = (int)(head & _mask);
+            item = _items[index];
+            _items[index] = default!; // drop references held by the slot
+            Volatile.Write(ref _head.Value, head + 1); // hands the slot back to the producer
+            return true;
+        }
+
+        [StructLayout(LayoutKind.Explicit, Size = 128)]
+        private struct PaddedPosition
+        {
+            [FieldOffset(64)] public long Value;
+        }
+    }
+}
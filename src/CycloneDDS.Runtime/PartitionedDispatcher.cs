@@ -0,0 +1,278 @@
+using System;
+using System.Diagnostics;
+using System.Threading;
+using System.Threading.Tasks;
+using CycloneDDS.Runtime.Memory;
+
+namespace CycloneDDS.Runtime
+{
+    /// <summary>
+    /// Queue metrics of one <see cref="PartitionedDispatcher{TView}"/> worker.
+    /// </summary>
+    public readonly struct DispatcherWorkerStats
+    {
+        internal DispatcherWorkerStats(int queueDepth, int maxQueueDepth, long processed, long failed, long stalls)
+        {
+            QueueDepth = queueDepth;
+            MaxQueueDepth = maxQueueDepth;
+            Processed = processed;
+            Failed = failed;
+            Stalls = stalls;
+        }
+
+        /// <summary>Samples currently queued.</summary>
+        public int QueueDepth { get; }
+
+        /// <summary>Highest queue depth observed.</summary>
+        public int MaxQueueDepth { get; }
+
+        /// <summary>Samples handed to the handler.</summary>
+        public long Processed { get; }
+
+        /// <summary>Samples whose handler threw.</summary>
+        public long Failed { get; }
+
+        /// <summary>Times the feeder found the queue full and had to wait (backpressure).</summary>
+        public long Stalls { get; }
+    }
+
+    /// <summary>
+    /// Processes samples on several worker threads while keeping the order within each instance.
+    /// Samples are routed by instance handle (or by a caller-supplied partition key), so one instance
+    /// always lands on the same worker; different instances run in parallel.
+    /// </summary>
+    /// <remarks>
+    /// Each worker has a single-producer/single-consumer ring. Feeding (<see cref="Poll{T}"/>,
+    /// <see cref="RunAsync{T}"/>, <see cref="Dispatch(ViewScope{TView})"/>, <see cref="Post"/>) is serialized.
+    /// When a worker's ring is full the feeder waits for it, which stops the take loop and leaves
+    /// further samples in the reader cache (and, with KEEP_ALL reliable QoS, pushes back on writers).
+    /// Samples are deserialized on the feeding thread; samples without valid data are not dispatched.
+    /// </remarks>
+    public sealed class PartitionedDispatcher<TView> : IDisposable where TView : struct
+    {
+        private readonly Action<TView> _handler;
+        private readonly Worker[] _workers;
+        private readonly object _feedLock = new object();
+        private volatile bool _stopping;
+        private int _disposed;
+        private Exception? _lastError;
+
+        /// <param name="handler">Called on a worker thread for each sample, in order per partition.</param>
+        /// <param name="workerCount">Number of worker threads; 0 uses the processor count.</param>
+        /// <param name="queueCapacity">Ring capacity per worker (rounded up to a power of two).</param>
+        public PartitionedDispatcher(Action<TView> handler, int workerCount = 0, int queueCapacity = 1024)
+        {
+            if (handler == null) throw new ArgumentNullException(nameof(handler));
+            if (workerCount < 0) throw new ArgumentOutOfRangeException(nameof(workerCount));
+            if (workerCount == 0) workerCount = Environment.ProcessorCount;
+
+            _handler = handler;
+            _workers = new Worker[workerCount];
+            for (int i = 0; i < workerCount; i++)
+            {
+                _workers[i] = new Worker(this, queueCapacity, i);
+            }
+        }
+
+        public int WorkerCount => _workers.Length;
+
+        /// <summary>Most recent exception thrown by the handler, if any.</summary>
+        public Exception? LastError => Volatile.Read(ref _lastError);
+
+        public DispatcherWorkerStats GetWorkerStats(int worker)
+        {
+            var w = _workers[worker];
+            return new DispatcherWorkerStats(w.Queue.Count, Volatile.Read(ref w.MaxDepth),
+                Interlocked.Read(ref w.Processed), Interlocked.Read(ref w.Failed), Interlocked.Read(ref w.Stalls));
+        }
+
+        /// <summary>
+        /// Takes up to <paramref name="maxSamples"/> samples from <paramref name="reader"/> and dispatches them.
+        /// Returns the number of samples taken.
+        /// </summary>
+        public int Poll<T>(DdsReader<T, TView> reader, int maxSamples = 256)
+        {
+            if (reader == null) throw new ArgumentNullException(nameof(reader));
+
+            using var scope = reader.Take(maxSamples);
+            Dispatch(scope);
+            return scope.Count;
+        }
+
+        /// <summary>
+        /// Dispatches samples from <paramref name="reader"/> until cancelled.
+        /// </summary>
+        public async Task RunAsync<T>(DdsReader<T, TView> reader, CancellationToken cancellationToken = default)
+        {
+            if (reader == null) throw new ArgumentNullException(nameof(reader));
+
+            while (!cancellationToken.IsCancellationRequested && !_stopping)
+            {
+                while (Poll(reader) > 0) { }
+                await reader.WaitDataAsync(cancellationToken).ConfigureAwait(false);
+            }
+        }
+
+        /// <summary>
+        /// Dispatches the valid samples of a taken or read scope, partitioned by instance handle.
+        /// </summary>
+        public void Dispatch(ViewScope<TView> scope)
+        {
+            var infos = scope.Infos;
+            lock (_feedLock)
+            {
+                for (int i = 0; i < scope.Count; i++)
+                {
+                    if (infos[i].ValidData == 0) continue;
+                    Enqueue(_workers[PartitionOf(infos[i].InstanceHandle)], scope[i]);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Dispatches one sample. Samples with the same <paramref name="partitionKey"/> (an instance handle,
+        /// or e.g. the hash of the generated key struct) are processed in posting order.
+        /// </summary>
+        public void Post(in TView sample, long partitionKey)
+        {
+            lock (_feedLock)
+            {
+                Enqueue(_workers[PartitionOf(partitionKey)], sample);
+            }
+        }
+
+        /// <summary>
+        /// Blocks until every dispatched sample has been processed, or the timeout expires.
+        /// </summary>
+        public bool WaitForIdle(TimeSpan timeout)
+        {
+            // Only observes the workers: Enqueue already woke them, and their signals go away on Dispose
+            var sw = Stopwatch.StartNew();
+            var spinner = new SpinWait();
+            foreach (var worker in _workers)
+            {
+                while (worker.Queue.Count > 0 || worker.Busy)
+                {
+                    if (sw.Elapsed > timeout) return false;
+                    spinner.SpinOnce();
+                }
+            }
+            return true;
+        }
+
+        private int PartitionOf(long key)
+        {
+            if (_workers.Length == 1) return 0;
+
+            // Fibonacci hashing; instance handles are not uniformly distributed in the low bits
+            ulong mixed = unchecked((ulong)key * 0x9E3779B97F4A7C15UL);
+            return (int)((mixed >> 32) % (uint)_workers.Length);
+        }
+
+        // Caller holds _feedLock (single producer per ring)
+        private void Enqueue(Worker worker, in TView sample)
+        {
+            if (_stopping) throw new ObjectDisposedException(nameof(PartitionedDispatcher<TView>));
+
+            if (!worker.Queue.TryEnqueue(sample))
+            {
+                Interlocked.Increment(ref worker.Stalls);
+                var spinner = new SpinWait();
+                while (!worker.Queue.TryEnqueue(sample))
+                {
+                    if (_stopping) throw new ObjectDisposedException(nameof(PartitionedDispatcher<TView>));
+                    worker.Wake();
+                    spinner.SpinOnce();
+                }
+            }
+
+            int depth = worker.Queue.Count;
+            if (depth > worker.MaxDepth) Volatile.Write(ref worker.MaxDepth, depth); // single writer
+
+            worker.Wake();
+        }
+
+        /// <summary>
+        /// Stops accepting samples, processes what is queued and joins the worker threads.
+        /// </summary>
+        public void Dispose()
+        {
+            if (Interlocked.Exchange(ref _disposed, 1) != 0) return;
+            _stopping = true;
+
+            // A feeder past its _stopping check may still be enqueuing; once the lock is free, every later
+            // Enqueue sees _stopping and throws, so nothing lands after the final drain or wakes a stopped worker.
+            // Set before locking: a feeder waiting on a full ring holds the lock until it sees the flag.
+            lock (_feedLock) { }
+
+            foreach (var worker in _workers) worker.Stop();
+        }
+
+        private sealed class Worker
+        {
+            public readonly SpscRingQueue<TView> Queue;
+            public long Processed;
+            public long Failed;
+            public long Stalls;
+            public int MaxDepth;
+            public volatile bool Busy;
+
+            private readonly PartitionedDispatcher<TView> _owner;
+            private readonly Thread _thread;
+
+            // Parks here when its ring is empty
+            private readonly ParkingSignal _parking = new ParkingSignal();
+
+            public Worker(PartitionedDispatcher<TView> owner, int capacity, int index)
+            {
+                _owner = owner;
+                Queue = new SpscRingQueue<TView>(capacity);
+                _thread = new Thread(Run)
+                {
+                    IsBackground = true,
+                    Name = $"PartitionedDispatcher<{typeof(TView).Name}>#{index}"
+                };
+                _thread.Start();
+            }
+
+            public void Wake() => _parking.Wake();
+
+            public void Stop()
+            {
+                _parking.Release();
+                _thread.Join();
+                _parking.Dispose();
+            }
+
+            private void Run()
+            {
+                var handler = _owner._handler;
+                while (true)
+                {
+                    Busy = true;
+                    bool any = false;
+                    while (Queue.TryDequeue(out var sample))
+                    {
+                        any = true;
+                        try
+                        {
+                            handler(sample);
+                        }
+                        catch (Exception ex)
+                        {
+                            Interlocked.Increment(ref Failed);
+                            Volatile.Write(ref _owner._lastError, ex);
+                        }
+                        Interlocked.Increment(ref Processed);
+                    }
+                    Busy = false;
+
+                    if (any) continue;
+                    if (_owner._stopping) return;
+
+                    _parking.Park(this, static self => self.Queue.Count == 0 && !self._owner._stopping);
+                }
+            }
+        }
+    }
+}
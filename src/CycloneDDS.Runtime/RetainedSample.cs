@@ -0,0 +1,84 @@
+using System;
+using CycloneDDS.Runtime.Interop;
+
+namespace CycloneDDS.Runtime
+{
+    /// <summary>
+    /// A sample kept alive past its <see cref="ViewScope{TView}"/> (see <see cref="ViewScope{TView}.Retain"/>).
+    /// Holds one reference to the received serdata, so nothing is copied or decoded until
+    /// <see cref="Decode"/> or <see cref="CopyTo"/> is called; it can be handed to other threads or kept in caches.
+    /// </summary>
+    /// <remarks>
+    /// The serdata stays in memory until the handle is disposed, even after the reader has dropped it
+    /// from its cache; dispose retained samples promptly. Do not dispose while another thread is decoding.
+    /// </remarks>
+    public sealed class RetainedSample<TView> : IDisposable where TView : struct
+    {
+        private readonly DeserializeDelegate<TView> _deserializer;
+        private IntPtr _serdata;
+
+        internal RetainedSample(IntPtr serdata, in DdsApi.DdsSampleInfo info, DeserializeDelegate<TView> deserializer)
+        {
+            _serdata = serdata;
+            _deserializer = deserializer;
+            Info = info;
+        }
+
+        /// <summary>Sample info as returned by the read or take.</summary>
+        public DdsApi.DdsSampleInfo Info { get; }
+
+        /// <summary>False for dispose/unregister notifications; <see cref="Decode"/> then returns default.</summary>
+        public bool HasData => Info.ValidData != 0;
+
+        /// <summary>
+        /// Size of the serialized sample, encapsulation header included.
+        /// </summary>
+        public int Size
+        {
+            get
+            {
+                var serdata = _serdata;
+                if (serdata == IntPtr.Zero) throw new ObjectDisposedException(nameof(RetainedSample<TView>));
+                return (int)DdsApi.ddsi_serdata_size(serdata);
+            }
+        }
+
+        /// <summary>
+        /// Deserializes the sample straight from the serdata buffer. Every call decodes again.
+        /// </summary>
+        public TView Decode()
+        {
+            var serdata = _serdata;
+            if (serdata == IntPtr.Zero) throw new ObjectDisposedException(nameof(RetainedSample<TView>));
+            if (!HasData) return default;
+
+            return SerdataDecoder.Decode(serdata, _deserializer);
+        }
+
+        /// <summary>
+        /// Copies the serialized sample (encapsulation header included) into <paramref name="destination"/>
+        /// and returns the number of bytes written.
+        /// </summary>
+        /// <exception cref="ArgumentException"><paramref name="destination"/> is smaller than <see cref="Size"/>.</exception>
+        public unsafe int CopyTo(Span<byte> destination)
+        {
+            int size = Size;
+            if (destination.Length < size) throw new ArgumentException($"Destination holds {destination.Length} bytes, sample needs {size}.", nameof(destination));
+
+            fixed (byte* p = destination)
+            {
+                DdsApi.ddsi_serdata_to_ser(_serdata, UIntPtr.Zero, (UIntPtr)size, (IntPtr)p);
+            }
+            return size;
+        }
+
+        /// <summary>
+        /// Drops the serdata reference.
+        /// </summary>
+        public void Dispose()
+        {
+            IntPtr serdata = System.Threading.Interlocked.Exchange(ref _serdata, IntPtr.Zero);
+            if (serdata != IntPtr.Zero) DdsApi.ddsi_serdata_unref(serdata);
+        }
+    }
+}
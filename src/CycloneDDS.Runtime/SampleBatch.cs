@@ -0,0 +1,147 @@
+using System;
+using System.Collections.Concurrent;
+using System.Threading;
+using CycloneDDS.Runtime.Interop;
+
+namespace CycloneDDS.Runtime
+{
+    /// <summary>
+    /// Samples of one take or read that, unlike <see cref="ViewScope{TView}"/>, may be kept across
+    /// <c>await</c>s and handed between pipeline stages. The batch owns the serdata references and
+    /// sample infos and decodes on access; <see cref="Dispose"/> releases the references and
+    /// returns the batch to a pool, so steady-state use does not allocate.
+    /// </summary>
+    /// <remarks>
+    /// A disposed batch is reused by a later take: do not touch it after <see cref="Dispose"/>.
+    /// A batch is not thread-safe, but may move between threads.
+    /// </remarks>
+    public sealed class SampleBatch<TView> : IDisposable where TView : struct
+    {
+        private const int MaxPooled = 64;
+        private static readonly ConcurrentQueue<SampleBatch<TView>> _pool = new();
+        private static int _pooledCount;
+
+        private IntPtr[] _samples;
+        private DdsApi.DdsSampleInfo[] _infos;
+        private DeserializeDelegate<TView>? _deserializer;
+        private int _count;
+        private int _rented;
+
+        private SampleBatch(int capacity)
+        {
+            _samples = new IntPtr[capacity];
+            _infos = new DdsApi.DdsSampleInfo[capacity];
+        }
+
+        internal static SampleBatch<TView> Rent(int capacity, DeserializeDelegate<TView> deserializer)
+        {
+            if (_pool.TryDequeue(out var batch))
+            {
+                Interlocked.Decrement(ref _pooledCount);
+                if (batch._samples.Length < capacity)
+                {
+                    batch._samples = new IntPtr[capacity];
+                    batch._infos = new DdsApi.DdsSampleInfo[capacity];
+                }
+            }
+            else
+            {
+                batch = new SampleBatch<TView>(capacity);
+            }
+
+            batch._deserializer = deserializer;
+            batch._count = 0;
+            Volatile.Write(ref batch._rented, 1);
+            return batch;
+        }
+
+        // Native read/take target; at least 'capacity' entries
+        internal IntPtr[] SampleBuffer => _samples;
+        internal DdsApi.DdsSampleInfo[] InfoBuffer => _infos;
+
+        internal void SetCount(int count) => _count = count;
+
+        public int Count
+        {
+            get
+            {
+                ThrowIfReturned();
+                return _count;
+            }
+        }
+
+        public ReadOnlySpan<DdsApi.DdsSampleInfo> Infos
+        {
+            get
+            {
+                ThrowIfReturned();
+                return _infos.AsSpan(0, _count);
+            }
+        }
+
+        /// <summary>False for dispose/unregister notifications; the indexer then returns default.</summary>
+        public bool HasData(int index)
+        {
+            if ((uint)index >= (uint)Count) throw new IndexOutOfRangeException();
+            return _infos[index].ValidData != 0;
+        }
+
+        /// <summary>
+        /// Deserializes the sample at <paramref name="index"/> in place; every access decodes again.
+        /// </summary>
+        public TView this[int index]
+        {
+            get
+            {
+                if ((uint)index >= (uint)Count) throw new IndexOutOfRangeException();
+                if (_infos[index].ValidData == 0 || _samples[index] == IntPtr.Zero) return default;
+                return SerdataDecoder.Decode(_samples[index], _deserializer!);
+            }
+        }
+
+        /// <summary>
+        /// Keeps one sample beyond the batch (see <see cref="ViewScope{TView}.Retain"/>).
+        /// </summary>
+        public RetainedSample<TView> Retain(int index)
+        {
+            if ((uint)index >= (uint)Count) throw new IndexOutOfRangeException();
+
+            IntPtr serdata = _samples[index];
+            if (serdata != IntPtr.Zero) DdsApi.ddsi_serdata_ref(serdata);
+            return new RetainedSample<TView>(serdata, _infos[index], _deserializer!);
+        }
+
+        private void ThrowIfReturned()
+        {
+            if (Volatile.Read(ref _rented) == 0) throw new ObjectDisposedException(nameof(SampleBatch<TView>));
+        }
+
+        /// <summary>
+        /// Releases the serdata references and returns the batch to the pool.
+        /// </summary>
+        public void Dispose()
+        {
+            if (Interlocked.Exchange(ref _rented, 0) == 0) return;
+
+            for (int i = 0; i < _count; i++)
+            {
+                if (_samples[i] != IntPtr.Zero)
+                {
+                    DdsApi.ddsi_serdata_unref(_samples[i]);
+                    _samples[i] = IntPtr.Zero;
+                }
+            }
+            _count = 0;
+            _deserializer = null;
+
+            if (Interlocked.Increment(ref _pooledCount) <= MaxPooled)
+            {
+                _pool.Enqueue(this);
+            }
+            else
+            {
+                Interlocked.Decrement(ref _pooledCount);
+            }
+        }
+    }
+}
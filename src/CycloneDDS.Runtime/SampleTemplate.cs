@@ -0,0 +1,147 @@
+using System;
+using System.Collections.Concurrent;
+using System.Linq.Expressions;
+using System.Reflection;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+using CycloneDDS.Core;
+using CycloneDDS.Runtime.Memory;
+
+namespace CycloneDDS.Runtime
+{
+    /// <summary>
+    /// A sample serialized once whose fixed-layout members are then patched in place.
+    /// For mostly-static samples (heartbeats, status) a cycle costs a few stores instead of a full serialization:
+    /// <code>
+    /// using var template = writer.CreateTemplate(status);
+    /// var counter = template.Field(x => x.Counter);    // resolve once
+    /// template.Set(counter, ++n);
+    /// writer.Write(template);
+    /// </code>
+    /// Patchable members are the non-key primitives and enums before the first variable-size member
+    /// (generated <c>TryGetFieldOffset</c>). Not thread-safe.
+    /// </summary>
+    public sealed class SampleTemplate<T> : IDisposable
+    {
+        private delegate bool TryGetFieldOffsetDelegate(string memberName, CdrEncoding encoding, out int offset, out int size);
+
+        private static readonly TryGetFieldOffsetDelegate? _tryGetFieldOffset = CreateOffsetLookup();
+        private static readonly ConcurrentDictionary<(string, CdrEncoding), (int Offset, int Size)> _offsets = new();
+
+        private byte[]? _buffer;
+        private readonly int _length;
+        private readonly CdrEncoding _encoding;
+        private readonly byte[]? _keyHash;
+
+        internal SampleTemplate(byte[] buffer, int length, CdrEncoding encoding, byte[]? keyHash)
+        {
+            _buffer = buffer;
+            _length = length;
+            _encoding = encoding;
+            _keyHash = keyHash;
+        }
+
+        /// <summary>
+        /// True if the generated type has field offsets (regenerate older topic types otherwise).
+        /// </summary>
+        public static bool IsSupported => _tryGetFieldOffset != null;
+
+        /// <summary>
+        /// The serialized sample, encapsulation header included.
+        /// </summary>
+        public ReadOnlySpan<byte> Cdr => CurrentBuffer.AsSpan(0, _length);
+
+        internal byte[]? KeyHash => _keyHash;
+
+        private byte[] CurrentBuffer => _buffer ?? throw new ObjectDisposedException(nameof(SampleTemplate<T>));
+
+        /// <summary>
+        /// Resolves a member for repeated <see cref="Set{TField}(TemplateField{TField}, TField)"/> calls.
+        /// </summary>
+        /// <exception cref="ArgumentException">The member is not patchable or <typeparamref name="TField"/> does not match its wire size.</exception>
+        public TemplateField<TField> Field<TField>(Expression<Func<T, TField>> member) where TField : unmanaged
+        {
+            if (member.Body is not MemberExpression { Member: FieldInfo or PropertyInfo } body || body.Expression is not ParameterExpression)
+            {
+                throw new ArgumentException("Expected a direct member access such as x => x.Counter.", nameof(member));
+            }
+            return Field<TField>(body.Member.Name);
+        }
+
+        /// <summary>
+        /// Resolves a member by name (see <see cref="Field{TField}(Expression{Func{T, TField}})"/>).
+        /// </summary>
+        public TemplateField<TField> Field<TField>(string memberName) where TField : unmanaged
+        {
+            if (_tryGetFieldOffset == null)
+            {
+                throw new NotSupportedException($"Type {typeof(T).Name} has no generated TryGetFieldOffset.");
+            }
+
+            var entry = _offsets.GetOrAdd((memberName, _encoding), static key =>
+                _tryGetFieldOffset!(key.Item1, key.Item2, out int offset, out int size) ? (offset, size) : (-1, 0));
+
+            if (entry.Offset < 0)
+            {
+                throw new ArgumentException(
+                    $"'{memberName}' is not a patchable member of {typeof(T).Name} (key, or after a variable-size member).", nameof(memberName));
+            }
+            if (entry.Size != Unsafe.SizeOf<TField>())
+            {
+                throw new ArgumentException(
+                    $"'{memberName}' is {entry.Size} bytes on the wire, {typeof(TField).Name} is {Unsafe.SizeOf<TField>()}.", nameof(memberName));
+            }
+            return new TemplateField<TField>(entry.Offset);
+        }
+
+        /// <summary>
+        /// Patches a member in the serialized buffer.
+        /// </summary>
+        public void Set<TField>(TemplateField<TField> field, TField value) where TField : unmanaged
+        {
+            if (field.Offset < 4) throw new ArgumentException("Field was not resolved by this template.", nameof(field));
+
+            var target = CurrentBuffer.AsSpan(field.Offset, Unsafe.SizeOf<TField>());
+            Unsafe.WriteUnaligned(ref MemoryMarshal.GetReference(target), value);
+
+            // CDR written by CdrWriter is little-endian
+            if (!BitConverter.IsLittleEndian) target.Reverse();
+        }
+
+        /// <summary>
+        /// Patches a member by expression. Builds an expression tree per call; prefer a cached <see cref="Field{TField}(Expression{Func{T, TField}})"/> on hot paths.
+        /// </summary>
+        public void Set<TField>(Expression<Func<T, TField>> member, TField value) where TField : unmanaged
+        {
+            Set(Field(member), value);
+        }
+
+        public void Dispose()
+        {
+            if (_buffer == null) return;
+            Arena.Return(_buffer);
+            _buffer = null;
+        }
+
+        private static TryGetFieldOffsetDelegate? CreateOffsetLookup()
+        {
+            var method = typeof(T).GetMethod("TryGetFieldOffset", BindingFlags.Public | BindingFlags.Static,
+                new[] { typeof(string), typeof(CdrEncoding), typeof(int).MakeByRefType(), typeof(int).MakeByRefType() });
+            return method == null ? null : (TryGetFieldOffsetDelegate)Delegate.CreateDelegate(typeof(TryGetFieldOffsetDelegate), method);
+        }
+    }
+
+    /// <summary>
+    /// A resolved patchable member of a <see cref="SampleTemplate{T}"/>.
+    /// </summary>
+    public readonly struct TemplateField<TField> where TField : unmanaged
+    {
+        internal TemplateField(int offset)
+        {
+            Offset = offset;
+        }
+
+        /// <summary>Byte offset in the serialized sample, encapsulation header included.</summary>
+        public int Offset { get; }
+    }
+}
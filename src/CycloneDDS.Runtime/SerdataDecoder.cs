@@ -0,0 +1,37 @@
+using System;
+using CycloneDDS.Core;
+using CycloneDDS.Runtime.Interop;
+
+namespace CycloneDDS.Runtime
+{
+    /// <summary>
+    /// Deserializes a serdata in place (<c>dds_serdata_to_ser_ref</c>), without copying it into a managed buffer.
+    /// </summary>
+    internal static class SerdataDecoder
+    {
+        public static unsafe TView Decode<TView>(IntPtr serdata, DeserializeDelegate<TView> deserializer) where TView : struct
+        {
+            uint size = DdsApi.ddsi_serdata_size(serdata);
+            if (size <= 4) return default;
+
+            IntPtr reference = DdsApi.ddsi_serdata_to_ser_ref(serdata, UIntPtr.Zero, (UIntPtr)size, out var iov);
+            try
+            {
+                var span = new ReadOnlySpan<byte>((void*)iov.iov_base, (int)iov.iov_len);
+
+                // Encapsulation identifier >= 6 is XCDR2 (stream origin 0); XCDR1 aligns from the body (4)
+                CdrEncoding encoding = span[1] >= 6 ? CdrEncoding.Xcdr2 : CdrEncoding.Xcdr1;
+                int origin = encoding == CdrEncoding.Xcdr2 ? 0 : 4;
+                var reader = new CdrReader(span, encoding, origin: origin);
+                reader.ReadInt32(); // Encapsulation header
+
+                deserializer(ref reader, out TView view);
+                return view;
+            }
+            finally
+            {
+                DdsApi.ddsi_serdata_to_ser_unref(reference, iov);
+            }
+        }
+    }
+}
@@ -0,0 +1,128 @@
+using System;
+using CycloneDDS.Runtime.Interop;
+
+namespace CycloneDDS.Runtime
+{
+    /// <summary>
+    /// A sample serialized once (see <see cref="DdsWriter{T}.Serialize"/>) and published by any number
+    /// of writers through <see cref="DdsWriter{T}.Write(SerializedSample{T})"/>.
+    /// Wraps a refcounted native serdata: writers whose topic shares the sertype only add a reference.
+    /// Writers on a different sertype (another domain, or a managed-sertype topic) get a serdata
+    /// built from the same CDR bytes once, which is then shared the same way.
+    /// </summary>
+    /// <remarks>
+    /// The handle holds one reference per serdata until disposed; writer history keeps its own.
+    /// The source timestamp is taken once, in <see cref="DdsWriter{T}.Serialize"/>, and every write publishes
+    /// it unchanged, so histories and reader caches of earlier writes are not re-stamped by later ones.
+    /// Without the patched <c>dds_serdata_set_source_timestamp</c> export writes fall back to <c>dds_writecdr</c>,
+    /// which stamps the shared serdata on each write.
+    /// Do not dispose while another thread is writing the sample.
+    /// </remarks>
+    public sealed class SerializedSample<T> : IDisposable
+    {
+        private readonly object _lock = new object();
+        private readonly byte[]? _keyHash;
+        private IntPtr _serdata;
+        private readonly IntPtr _sertype;
+
+        // Serdata created for other sertypes (sertype -> serdata holding one ref)
+        private (IntPtr Sertype, IntPtr Serdata)[]? _converted;
+        private int _convertedCount;
+
+        internal SerializedSample(IntPtr serdata, IntPtr sertype, byte[]? keyHash, long sourceTimestamp)
+        {
+            _serdata = serdata;
+            _sertype = sertype;
+            _keyHash = keyHash;
+            SourceTimestamp = sourceTimestamp;
+        }
+
+        /// <summary>
+        /// Source timestamp every write of this sample carries, in nanoseconds since the Unix epoch.
+        /// </summary>
+        public long SourceTimestamp { get; }
+
+        /// <summary>
+        /// Size of the serialized sample, encapsulation header included.
+        /// </summary>
+        public int Size
+        {
+            get
+            {
+                if (_serdata == IntPtr.Zero) throw new ObjectDisposedException(nameof(SerializedSample<T>));
+                return (int)DdsApi.ddsi_serdata_size(_serdata);
+            }
+        }
+
+        /// <summary>
+        /// Serdata of this sample for <paramref name="sertype"/>, without adding a reference.
+        /// </summary>
+        internal unsafe IntPtr GetSerdata(DdsWriter<T> writer, IntPtr sertype)
+        {
+            IntPtr primary = _serdata;
+            if (primary == IntPtr.Zero) throw new ObjectDisposedException(nameof(SerializedSample<T>));
+            if (sertype == _sertype) return primary;
+
+            lock (_lock)
+            {
+                for (int i = 0; i < _convertedCount; i++)
+                {
+                    if (_converted![i].Sertype == sertype) return _converted[i].Serdata;
+                }
+
+                uint size = DdsApi.ddsi_serdata_size(primary);
+                IntPtr reference = DdsApi.ddsi_serdata_to_ser_ref(primary, UIntPtr.Zero, (UIntPtr)size, out var iov);
+                IntPtr serdata;
+                try
+                {
+                    serdata = writer.CreateSerdataFromCdr(
+                        new ReadOnlySpan<byte>((void*)iov.iov_base, (int)iov.iov_len),
+                        _keyHash);
+                }
+                finally
+                {
+                    DdsApi.ddsi_serdata_to_ser_unref(reference, iov);
+                }
+
+                if (serdata == IntPtr.Zero)
+                {
+                    throw new DdsException(DdsApi.DdsReturnCode.Error, "Failed to create serdata for the writer's sertype");
+                }
+                if (DdsWriter<T>.StampsSharedSamples) DdsApi.dds_serdata_set_source_timestamp(serdata, SourceTimestamp);
+
+                if (_converted == null)
+                {
+                    _converted = new (IntPtr, IntPtr)[2];
+                }
+                else if (_convertedCount == _converted.Length)
+                {
+                    Array.Resize(ref _converted, _converted.Length * 2);
+                }
+                _converted[_convertedCount++] = (sertype, serdata);
+                return serdata;
+            }
+        }
+
+        /// <summary>
+        /// Drops the references held by this handle. The native buffers are freed (managed-sertype
+        /// buffers returned to the arena) once the writers release theirs as well.
+        /// </summary>
+        public void Dispose()
+        {
+            lock (_lock)
+            {
+                if (_serdata == IntPtr.Zero) return;
+
+                DdsApi.ddsi_serdata_unref(_serdata);
+                _serdata = IntPtr.Zero;
+
+                for (int i = 0; i < _convertedCount; i++)
+                {
+                    DdsApi.ddsi_serdata_unref(_converted![i].Serdata);
+                }
+                _converted = null;
+                _convertedCount = 0;
+            }
+        }
+    }
+}
@@ -0,0 +1,131 @@
+using System;
+using System.Threading.Tasks;
+using CycloneDDS.Core;
+
+namespace CycloneDDS.Runtime
+{
+    /// <summary>
+    /// Publishes one topic through several native writers so that concurrent <see cref="Write"/> calls
+    /// do not all serialize on a single Cyclone writer lock.
+    /// </summary>
+    /// <remarks>
+    /// Samples are routed by the generated key hash, so every instance always goes through the same
+    /// writer and keeps its ordering. Keyless topics are routed by the calling thread instead, which
+    /// keeps the ordering of each producer thread.
+    /// Readers see one publication per shard; with EXCLUSIVE ownership only one of them would be accepted
+    /// for a given instance, so shard only topics with the default SHARED ownership.
+    /// </remarks>
+    public sealed class ShardedWriter<T> : IDisposable
+    {
+        // Without a generated key serializer every sample maps to the same (zero) instance digest
+        private static readonly bool _keyless = DdsKeySerializer<T>.Serializer == null;
+
+        private readonly DdsWriter<T>[] _shards;
+        private bool _disposed;
+
+        /// <param name="participant">Participant owning the writers.</param>
+        /// <param name="topicName">Topic to publish.</param>
+        /// <param name="shardCount">Number of native writers; 0 uses the processor count (at most 8).</param>
+        /// <param name="qos">Writer QoS applied to every shard.</param>
+        public ShardedWriter(DdsParticipant participant, string topicName, int shardCount = 0, IntPtr qos = default)
+        {
+            if (participant == null) throw new ArgumentNullException(nameof(participant));
+            if (shardCount < 0) throw new ArgumentOutOfRangeException(nameof(shardCount));
+            if (shardCount == 0) shardCount = Math.Min(Environment.ProcessorCount, 8);
+
+            _shards = new DdsWriter<T>[shardCount];
+            try
+            {
+                for (int i = 0; i < shardCount; i++)
+                {
+                    _shards[i] = new DdsWriter<T>(participant, topicName, qos);
+                }
+            }
+            catch
+            {
+                foreach (var shard in _shards) shard?.Dispose();
+                throw;
+            }
+        }
+
+        /// <summary>Number of native writers.</summary>
+        public int ShardCount => _shards.Length;
+
+        /// <summary>
+        /// The writer a sample is routed to, e.g. to wait for matching or to attach pacing per shard.
+        /// </summary>
+        public DdsWriter<T> GetShard(in T sample) => _shards[ShardOf(sample)];
+
+        /// <summary>Writer by index.</summary>
+        public DdsWriter<T> this[int index] => _shards[index];
+
+        public void Write(in T sample) => CurrentShard(sample).Write(sample);
+
+        /// <inheritdoc cref="DdsWriter{T}.WriteIfChanged"/>
+        public bool WriteIfChanged(in T sample) => CurrentShard(sample).WriteIfChanged(sample);
+
+        public void DisposeInstance(in T sample) => CurrentShard(sample).DisposeInstance(sample);
+
+        public void UnregisterInstance(in T sample) => CurrentShard(sample).UnregisterInstance(sample);
+
+        /// <summary>Flushes every shard (<see cref="DdsWriter{T}.Flush"/>).</summary>
+        public void Flush()
+        {
+            if (_disposed) throw new ObjectDisposedException(nameof(ShardedWriter<T>));
+            foreach (var shard in _shards) shard.Flush();
+        }
+
+        /// <summary>
+        /// Waits until every shard has matched at least one reader.
+        /// </summary>
+        public async Task<bool> WaitForReaderAsync(TimeSpan timeout = default)
+        {
+            if (_disposed) throw new ObjectDisposedException(nameof(ShardedWriter<T>));
+
+            var waits = new Task<bool>[_shards.Length];
+            for (int i = 0; i < _shards.Length; i++)
+            {
+                waits[i] = _shards[i].WaitForReaderAsync(timeout);
+            }
+
+            foreach (bool matched in await Task.WhenAll(waits))
+            {
+                if (!matched) return false;
+            }
+            return true;
+        }
+
+        private DdsWriter<T> CurrentShard(in T sample)
+        {
+            if (_disposed) throw new ObjectDisposedException(nameof(ShardedWriter<T>));
+            return _shards[ShardOf(sample)];
+        }
+
+        private int ShardOf(in T sample)
+        {
+            if (_shards.Length == 1) return 0;
+
+            uint hash;
+            if (_keyless)
+            {
+                hash = (uint)Environment.CurrentManagedThreadId;
+            }
+            else
+            {
+                Span<byte> digest = stackalloc byte[KeyHashWriter.HashSize];
+                _shards[0].ComputeInstanceDigest(sample, digest);
+                var (lo, hi) = InstanceDigest.Read(digest);
+                hash = (uint)(InstanceDigest.Mix(lo, hi) >> 32);
+            }
+            return (int)(hash % (uint)_shards.Length);
+        }
+
+        public void Dispose()
+        {
+            if (_disposed) return;
+            _disposed = true;
+
+            foreach (var shard in _shards) shard.Dispose();
+        }
+    }
+}
@@ -0,0 +1,142 @@
+using System;
+using System.Diagnostics;
+using System.Threading;
+
+namespace CycloneDDS.Runtime
+{
+    /// <summary>
+    /// Byte-rate and sample-rate token bucket for <see cref="DdsWriter{T}"/>, so bursts
+    /// (e.g. replaying buffered samples) are spread out instead of overrunning socket buffers.
+    /// Assign to <see cref="DdsWriter{T}.Pacing"/> and publish with
+    /// <see cref="DdsWriter{T}.TryWrite"/> or <see cref="DdsWriter{T}.WriteAsync"/>.
+    /// </summary>
+    /// <remarks>
+    /// Each bucket is a GCRA (virtual scheduling): one theoretical arrival time advanced with a
+    /// compare-and-swap, so acquiring credit takes no lock. A bucket admits up to its rate times
+    /// <c>burstWindow</c> ahead of schedule. The other writes (<see cref="DdsWriter{T}.Write(in T)"/>,
+    /// raw CDR, templates, serialized samples) are charged without being refused, which may put the bucket in debt.
+    /// </remarks>
+    public sealed class WriterPacing
+    {
+        private readonly Bucket? _bytes;
+        private readonly Bucket? _samples;
+
+        /// <param name="bytesPerSecond">Serialized bytes per second; 0 for no byte limit.</param>
+        /// <param name="samplesPerSecond">Samples per second; 0 for no sample limit.</param>
+        /// <param name="burstWindow">How far ahead of the rate a burst may go; defaults to 50 ms.</param>
+        public WriterPacing(double bytesPerSecond = 0, double samplesPerSecond = 0, TimeSpan? burstWindow = null)
+        {
+            if (bytesPerSecond < 0) throw new ArgumentOutOfRangeException(nameof(bytesPerSecond));
+            if (samplesPerSecond < 0) throw new ArgumentOutOfRangeException(nameof(samplesPerSecond));
+
+            double window = (burstWindow ?? TimeSpan.FromMilliseconds(50)).TotalSeconds;
+            if (window < 0) throw new ArgumentOutOfRangeException(nameof(burstWindow));
+
+            if (bytesPerSecond > 0) _bytes = new Bucket(bytesPerSecond, window);
+            if (samplesPerSecond > 0) _samples = new Bucket(samplesPerSecond, window);
+        }
+
+        /// <summary>
+        /// Takes credit for one sample of <paramref name="bytes"/> if both buckets allow it.
+        /// Otherwise returns false and the time until enough credit is available.
+        /// </summary>
+        internal bool TryAcquire(int bytes, out TimeSpan retryAfter)
+        {
+            retryAfter = TimeSpan.Zero;
+
+            if (_bytes != null && !_bytes.TryTake(bytes, out double wait))
+            {
+                retryAfter = TimeSpan.FromSeconds(wait);
+                return false;
+            }
+
+            if (_samples != null && !_samples.TryTake(1, out double sampleWait))
+            {
+                // Give the byte credit back; approximate under contention, which is fine for pacing
+                _bytes?.Refund(bytes);
+                retryAfter = TimeSpan.FromSeconds(sampleWait);
+                return false;
+            }
+
+            return true;
+        }
+
+        /// <summary>
+        /// Charges a sample that is written regardless of credit.
+        /// </summary>
+        internal void Charge(int bytes)
+        {
+            _bytes?.Take(bytes);
+            _samples?.Take(1);
+        }
+
+        internal bool LimitsBytes => _bytes != null;
+
+        private sealed class Bucket
+        {
+            private static readonly double _secondsPerTick = 1.0 / Stopwatch.Frequency;
+
+            private readonly long _origin = Stopwatch.GetTimestamp();
+            private readonly double _secondsPerUnit;
+            private readonly double _tolerance;
+
+            // Theoretical arrival time in seconds since _origin, stored as double bits for CAS
+            private long _tat;
+
+            public Bucket(double unitsPerSecond, double burstWindow)
+            {
+                _secondsPerUnit = 1.0 / unitsPerSecond;
+                _tolerance = burstWindow;
+            }
+
+            private double Now => (Stopwatch.GetTimestamp() - _origin) * _secondsPerTick;
+
+            public bool TryTake(double units, out double wait)
+            {
+                double increment = units * _secondsPerUnit;
+                while (true)
+                {
+                    long observed = Volatile.Read(ref _tat);
+                    double now = Now;
+                    double next = Math.Max(BitConverter.Int64BitsToDouble(observed), now) + increment;
+
+                    // A single unit larger than the burst window is admitted when the bucket is idle
+                    double ahead = next - now;
+                    if (ahead > _tolerance && ahead > increment)
+                    {
+                        wait = ahead - Math.Max(_tolerance, increment);
+                        return false;
+                    }
+
+                    if (Interlocked.CompareExchange(ref _tat, BitConverter.DoubleToInt64Bits(next), observed) == observed)
+                    {
+                        wait = 0;
+                        return true;
+                    }
+                }
+            }
+
+            public void Take(double units)
+            {
+                double increment = units * _secondsPerUnit;
+                while (true)
+                {
+                    long observed = Volatile.Read(ref _tat);
+                    double next = Math.Max(BitConverter.Int64BitsToDouble(observed), Now) + increment;
+                    if (Interlocked.CompareExchange(ref _tat, BitConverter.DoubleToInt64Bits(next), observed) == observed) return;
+                }
+            }
+
+            public void Refund(double units)
+            {
+                double decrement = units * _secondsPerUnit;
+                while (true)
+                {
+                    long observed = Volatile.Read(ref _tat);
+                    double next = BitConverter.Int64BitsToDouble(observed) - decrement;
+                    if (Interlocked.CompareExchange(ref _tat, BitConverter.DoubleToInt64Bits(next), observed) == observed) return;
+                }
+            }
+        }
+    }
+}
@@ -171,6 +171,178 @@ namespace TestNamespace
             Assert.Equal("Hello World from DDS!", (string)dataType.GetField("Message").GetValue(result));
         }
 
+        private static TypeInfo CreateKeyRoutedType(CycloneDDS.Schema.DdsExtensibilityKind extensibility)
+        {
+            var key = new List<AttributeInfo> { new AttributeInfo { Name = "DdsKey" } };
+            var managed = new List<AttributeInfo> { new AttributeInfo { Name = "DdsManaged" } };
+            return new TypeInfo
+            {
+                Name = "KeyRouted",
+                Namespace = "TestNamespace",
+                Extensibility = extensibility,
+                Fields = new List<FieldInfo>
+                {
+                    new FieldInfo { Name = "Value", TypeName = "double" },
+                    new FieldInfo { Name = "Payload", TypeName = "string", Attributes = managed },
+                    new FieldInfo { Name = "Id", TypeName = "int", Attributes = key },
+                    new FieldInfo { Name = "Tag", TypeName = "string", Attributes = new List<AttributeInfo> { new AttributeInfo { Name = "DdsKey" }, new AttributeInfo { Name = "DdsManaged" } } },
+                    new FieldInfo { Name = "Trailing", TypeName = "long" }
+                }
+            };
+        }
+
+        [Theory]
+        [InlineData(CycloneDDS.Schema.DdsExtensibilityKind.Final, false)]
+        [InlineData(CycloneDDS.Schema.DdsExtensibilityKind.Appendable, true)]
+        [InlineData(CycloneDDS.Schema.DdsExtensibilityKind.Appendable, false)]
+        public void ReadKey_ExtractsKeyFromFullSample(CycloneDDS.Schema.DdsExtensibilityKind extensibility, bool xcdr2)
+        {
+            var type = CreateKeyRoutedType(extensibility);
+            string serializedCode = new SerializerEmitter().EmitSerializer(type, new GlobalTypeRegistry());
+            string deserializedCode = new DeserializerEmitter().EmitDeserializer(type, new GlobalTypeRegistry());
+
+            Assert.Contains("public readonly struct KeyRoutedKey : System.IEquatable<KeyRoutedKey>", deserializedCode);
+            Assert.Contains("reader.ReadStringBytes();", deserializedCode); // non-key string skipped, not decoded
+
+            string combinedCode =
+@"using System;
+using System.Text;
+using System.Linq;
+using System.Collections.Generic;
+using CycloneDDS.Core;
+using System.Runtime.InteropServices;
+using System.Buffers;
+
+namespace TestNamespace
+{
+    public partial struct KeyRouted
+    {
+        public double Value;
+        public string Payload;
+        public int Id;
+        public string Tag;
+        public long Trailing;
+    }
+" + ExtractBody(serializedCode) + "\n" + ExtractBody(deserializedCode) + @"
+
+    public static class KeyHelper
+    {
+        public static object[] Run(object input, bool xcdr2)
+        {
+            var data = (KeyRouted)input;
+            var encoding = xcdr2 ? CdrEncoding.Xcdr2 : CdrEncoding.Xcdr1;
+            var buffer = new ArrayBufferWriter<byte>();
+            var writer = new CdrWriter(buffer, encoding);
+            data.Serialize(ref writer);
+            writer.Complete();
+
+            var reader = new CdrReader(buffer.WrittenSpan, encoding);
+            var key = KeyRouted.ReadKey(ref reader);
+
+            var whole = new CdrReader(buffer.WrittenSpan, encoding);
+            var again = KeyRouted.ReadKey(ref whole, skipToEnd: true);
+
+            var keyOnly = new CdrReader(buffer.WrittenSpan, encoding);
+            var keySample = KeyRouted.ReadKeySample(ref keyOnly);
+            Span<byte> expected = stackalloc byte[16];
+            Span<byte> actual = stackalloc byte[16];
+            KeyRouted.ComputeKeyHash(data, expected);
+            KeyRouted.ComputeKeyHash(keySample, actual);
+
+            return new object[]
+            {
+                key.Id, key.Tag,
+                key == data.GetKey(), key.GetHashCode() == again.GetHashCode(),
+                whole.Position == buffer.WrittenCount,
+                key != new KeyRoutedKey(key.Id + 1, key.Tag),
+                expected.SequenceEqual(actual), keySample.Trailing == 0
+            };
+        }
+    }
+}";
+            var assembly = CompileToAssembly(combinedCode, "ReadKey" + extensibility + xcdr2);
+            var dataType = assembly.GetType("TestNamespace.KeyRouted");
+            var input = Activator.CreateInstance(dataType);
+            dataType.GetField("Value").SetValue(input, 2.5);
+            dataType.GetField("Payload").SetValue(input, new string('x', 1000));
+            dataType.GetField("Id").SetValue(input, 42);
+            dataType.GetField("Tag").SetValue(input, "sensor-7");
+            dataType.GetField("Trailing").SetValue(input, 99L);
+
+            var result = (object[])assembly.GetType("TestNamespace.KeyHelper").GetMethod("Run").Invoke(null, new object[] { input, xcdr2 });
+
+            Assert.Equal(42, (int)result[0]);
+            Assert.Equal("sensor-7", (string)result[1]);
+            Assert.True((bool)result[2]);  // matches GetKey()
+            Assert.True((bool)result[3]);  // stable hash
+            Assert.True((bool)result[4]);  // skipToEnd consumes the whole sample
+            Assert.True((bool)result[5]);  // member-wise equality
+            Assert.True((bool)result[6]);  // key sample hashes like the full sample
+            Assert.True((bool)result[7]);  // members after the key are not read
+        }
+
+        [Fact]
+        public void KeyStruct_KeywordMemberNames_Compile()
+        {
+            var key = new List<AttributeInfo> { new AttributeInfo { Name = "DdsKey" } };
+            var type = new TypeInfo
+            {
+                Name = "KeywordKeyed",
+                Namespace = "TestNamespace",
+                Fields = new List<FieldInfo>
+                {
+                    new FieldInfo { Name = "Class", TypeName = "int", Attributes = key },
+                    new FieldInfo { Name = "Event", TypeName = "long", Attributes = key },
+                    new FieldInfo { Name = "Value", TypeName = "double" }
+                }
+            };
+            string serializedCode = new SerializerEmitter().EmitSerializer(type, new GlobalTypeRegistry());
+            string deserializedCode = new DeserializerEmitter().EmitDeserializer(type, new GlobalTypeRegistry());
+
+            Assert.Contains("public KeywordKeyedKey(int @class, long @event)", deserializedCode);
+
+            string combinedCode =
+@"using System;
+using System.Text;
+using System.Linq;
+using System.Collections.Generic;
+using CycloneDDS.Core;
+using System.Runtime.InteropServices;
+using System.Buffers;
+
+namespace TestNamespace
+{
+    public partial struct KeywordKeyed
+    {
+        public int Class;
+        public long Event;
+        public double Value;
+    }
+" + ExtractBody(serializedCode) + "\n" + ExtractBody(deserializedCode) + @"
+}";
+            var assembly = CompileToAssembly(combinedCode, "KeywordKeyed");
+            var keyType = assembly.GetType("TestNamespace.KeywordKeyedKey");
+            var keyValue = Activator.CreateInstance(keyType, 3, 7L);
+            Assert.Equal(3, (int)keyType.GetField("Class").GetValue(keyValue));
+            Assert.Equal(7L, (long)keyType.GetField("Event").GetValue(keyValue));
+        }
+
+        [Fact]
+        public void ReadKey_NotEmittedForKeylessTypes()
+        {
+            var type = new TypeInfo
+            {
+                Name = "Unkeyed",
+                Namespace = "TestNamespace",
+                Fields = new List<FieldInfo> { new FieldInfo { Name = "Id", TypeName = "int" } }
+            };
+
+            string code = new DeserializerEmitter().EmitDeserializer(type, new GlobalTypeRegistry());
+
+            Assert.DoesNotContain("ReadKey", code);
+            Assert.DoesNotContain("UnkeyedKey", code);
+        }
+
         private string ExtractBody(string code)
         {
             // Extract content inside namespace { ... }
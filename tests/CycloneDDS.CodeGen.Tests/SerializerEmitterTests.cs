@@ -120,6 +120,354 @@ namespace TestNamespace
             Assert.Equal(expected, actual);
         }
 
+        [Fact]
+        public void GeneratedCode_SerializeKey_WritesOnlyKeyFields()
+        {
+            var type = new TypeInfo
+            {
+                Name = "KeyedPrimitive",
+                Namespace = "TestNamespace",
+                Extensibility = CycloneDDS.Schema.DdsExtensibilityKind.Final,
+                Fields = new List<FieldInfo>
+                {
+                    new FieldInfo { Name = "Value", TypeName = "double" },
+                    new FieldInfo { Name = "Id", TypeName = "int", Attributes = new List<AttributeInfo> { new AttributeInfo { Name = "DdsKey" } } }
+                }
+            };
+
+            var emitter = new SerializerEmitter();
+            string generatedCode = emitter.EmitSerializer(type, new GlobalTypeRegistry());
+
+            string structDef = @"
+namespace TestNamespace
+{
+    public partial struct KeyedPrimitive
+    {
+        public double Value;
+        public int Id;
+    }
+
+    public static class KeyTestHelper
+    {
+        public static void SerializeKeyWithBuffer(object instance, System.Buffers.IBufferWriter<byte> buffer)
+        {
+            var typedInstance = (KeyedPrimitive)instance;
+            var writer = new CycloneDDS.Core.CdrWriter(buffer);
+            typedInstance.SerializeKey(ref writer);
+            writer.Complete();
+        }
+
+        public static byte[] ComputeKeyHash(object instance)
+        {
+            var hash = new byte[16];
+            KeyedPrimitive.ComputeKeyHash((KeyedPrimitive)instance, hash);
+            return hash;
+        }
+    }
+}
+";
+            string code = "using System.Buffers;\n" + generatedCode + "\n" + structDef;
+
+            var assembly = CompileToAssembly(code, "KeyedPrimitiveAssembly");
+            var generatedType = assembly.GetType("TestNamespace.KeyedPrimitive");
+            Assert.NotNull(generatedType);
+
+            var instance = Activator.CreateInstance(generatedType);
+            generatedType.GetField("Id").SetValue(instance, 123456789);
+            generatedType.GetField("Value").SetValue(instance, 123.456);
+
+            var getKeySizeMethod = generatedType.GetMethod("GetKeySerializedSize");
+            Assert.NotNull(getKeySizeMethod);
+            int keySize = (int)getKeySizeMethod.Invoke(instance, new object[] { 0, CdrEncoding.Xcdr1 });
+            Assert.Equal(4, keySize);
+
+            var writerBuffer = new ArrayBufferWriter<byte>();
+            assembly.GetType("TestNamespace.KeyTestHelper").GetMethod("SerializeKeyWithBuffer")
+                .Invoke(null, new object[] { instance, writerBuffer });
+
+            // Only the key: Id = 123456789 (LE), no Value
+            Assert.Equal("15 CD 5B 07", ToHex(writerBuffer.WrittenSpan.ToArray()));
+
+            // Key hash: big-endian key, zero-padded to 16 bytes (max key size 4 <= 16, no MD5)
+            var hash = (byte[])assembly.GetType("TestNamespace.KeyTestHelper").GetMethod("ComputeKeyHash")
+                .Invoke(null, new object[] { instance });
+            Assert.Equal("07 5B CD 15 00 00 00 00 00 00 00 00 00 00 00 00", ToHex(hash));
+        }
+
+        [Fact]
+        public void GeneratedCode_ComputeKeyHash_StringKey_UsesMd5()
+        {
+            var type = new TypeInfo
+            {
+                Name = "StringKeyed",
+                Namespace = "TestNamespace",
+                Fields = new List<FieldInfo>
+                {
+                    new FieldInfo { Name = "Name", TypeName = "string", Attributes = new List<AttributeInfo> { new AttributeInfo { Name = "DdsKey" } } },
+                    new FieldInfo { Name = "Value", TypeName = "int" }
+                }
+            };
+
+            string generatedCode = new SerializerEmitter().EmitSerializer(type, new GlobalTypeRegistry());
+            Assert.Contains("useMd5: true", generatedCode);
+
+            string structDef = @"
+namespace TestNamespace
+{
+    public partial struct StringKeyed
+    {
+        public string Name;
+        public int Value;
+    }
+
+    public static class StringKeyTestHelper
+    {
+        public static byte[] ComputeKeyHash(string name)
+        {
+            var hash = new byte[16];
+            StringKeyed.ComputeKeyHash(new StringKeyed { Name = name, Value = 1 }, hash);
+            return hash;
+        }
+    }
+}
+";
+            string code = "using System.Buffers;\n" + generatedCode + "\n" + structDef;
+            var assembly = CompileToAssembly(code, "StringKeyedAssembly");
+
+            var hash = (byte[])assembly.GetType("TestNamespace.StringKeyTestHelper").GetMethod("ComputeKeyHash")
+                .Invoke(null, new object[] { "abc" });
+
+            // MD5 of BE length (incl. NUL) + "abc" + NUL
+            byte[] expected = System.Security.Cryptography.MD5.HashData(new byte[] { 0, 0, 0, 4, (byte)'a', (byte)'b', (byte)'c', 0 });
+            Assert.Equal(expected, hash);
+        }
+
+        [Fact]
+        public void GeneratedCode_ComputeKeyHash_BoundedStringKey_IsFixed()
+        {
+            var type = new TypeInfo
+            {
+                Name = "BoundedStringKeyed",
+                Namespace = "TestNamespace",
+                Fields = new List<FieldInfo>
+                {
+                    new FieldInfo
+                    {
+                        Name = "Name", TypeName = "string",
+                        Attributes = new List<AttributeInfo>
+                        {
+                            new AttributeInfo { Name = "DdsKey" },
+                            new AttributeInfo { Name = "MaxLength", Arguments = new List<object> { 8 } }
+                        }
+                    },
+                    new FieldInfo { Name = "Value", TypeName = "int" }
+                }
+            };
+
+            string generatedCode = new SerializerEmitter().EmitSerializer(type, new GlobalTypeRegistry());
+
+            // 4 (length) + 8 + 1 (NUL) = 13 bytes at most: the stream itself is the hash
+            Assert.Contains("useMd5: false", generatedCode);
+            Assert.Contains("max key size 13", generatedCode);
+
+            string structDef = @"
+namespace TestNamespace
+{
+    public partial struct BoundedStringKeyed
+    {
+        public string Name;
+        public int Value;
+    }
+
+    public static class BoundedStringKeyTestHelper
+    {
+        public static byte[] ComputeKeyHash(string name, bool? useMd5)
+        {
+            var hash = new byte[16];
+            var sample = new BoundedStringKeyed { Name = name, Value = 1 };
+            if (useMd5.HasValue) BoundedStringKeyed.ComputeKeyHash(sample, hash, useMd5.Value);
+            else BoundedStringKeyed.ComputeKeyHash(sample, hash);
+            return hash;
+        }
+    }
+}
+";
+            string code = "using System.Buffers;\n" + generatedCode + "\n" + structDef;
+            var assembly = CompileToAssembly(code, "BoundedStringKeyedAssembly");
+            var helper = assembly.GetType("TestNamespace.BoundedStringKeyTestHelper").GetMethod("ComputeKeyHash");
+
+            var hash = (byte[])helper.Invoke(null, new object[] { "abc", null });
+            Assert.Equal("00 00 00 04 61 62 63 00 00 00 00 00 00 00 00 00", ToHex(hash));
+
+            // The mode the runtime takes from the descriptor flagset overrides the estimate
+            var md5 = (byte[])helper.Invoke(null, new object[] { "abc", true });
+            byte[] expected = System.Security.Cryptography.MD5.HashData(new byte[] { 0, 0, 0, 4, (byte)'a', (byte)'b', (byte)'c', 0 });
+            Assert.Equal(expected, md5);
+        }
+
+        [Fact]
+        public void GeneratedCode_WithoutKeys_HasNoSerializeKey()
+        {
+            var type = new TypeInfo
+            {
+                Name = "UnkeyedPrimitive",
+                Namespace = "TestNamespace",
+                Fields = new List<FieldInfo> { new FieldInfo { Name = "Id", TypeName = "int" } }
+            };
+
+            string generatedCode = new SerializerEmitter().EmitSerializer(type, new GlobalTypeRegistry());
+
+            Assert.DoesNotContain("SerializeKey", generatedCode);
+            Assert.DoesNotContain("GetKeySerializedSize", generatedCode);
+            Assert.DoesNotContain("ComputeKeyHash", generatedCode);
+        }
+
+        [Fact]
+        public void GeneratedCode_TryGetFieldOffset_MatchesSerializedLayout()
+        {
+            var type = new TypeInfo
+            {
+                Name = "TemplatePrimitive",
+                Namespace = "TestNamespace",
+                Extensibility = CycloneDDS.Schema.DdsExtensibilityKind.Appendable,
+                Fields = new List<FieldInfo>
+                {
+                    new FieldInfo { Name = "Id", TypeName = "int", Attributes = new List<AttributeInfo> { new AttributeInfo { Name = "DdsKey" } } },
+                    new FieldInfo { Name = "Flag", TypeName = "byte" },
+                    new FieldInfo { Name = "Value", TypeName = "double" },
+                    new FieldInfo { Name = "Name", TypeName = "string", Attributes = new List<AttributeInfo> { new AttributeInfo { Name = "DdsManaged" } } },
+                    new FieldInfo { Name = "After", TypeName = "int" }
+                }
+            };
+
+            string generatedCode = new SerializerEmitter().EmitSerializer(type, new GlobalTypeRegistry());
+
+            string structDef = @"
+namespace TestNamespace
+{
+    public partial struct TemplatePrimitive
+    {
+        public int Id;
+        public byte Flag;
+        public double Value;
+        public string Name;
+        public int After;
+    }
+
+    public static class TemplateTestHelper
+    {
+        public static byte[] SerializeWithHeader(object instance, bool xcdr2)
+        {
+            var encoding = xcdr2 ? CdrEncoding.Xcdr2 : CdrEncoding.Xcdr1;
+            var buffer = new byte[128];
+            var writer = new CdrWriter(buffer, encoding, origin: xcdr2 ? 0 : 4);
+            writer.WriteInt32(0); // encapsulation header placeholder
+            ((TemplatePrimitive)instance).Serialize(ref writer);
+            writer.Complete();
+            return buffer;
+        }
+
+        public static int GetOffset(string name, bool xcdr2)
+        {
+            return TemplatePrimitive.TryGetFieldOffset(name, xcdr2 ? CdrEncoding.Xcdr2 : CdrEncoding.Xcdr1, out int offset, out _) ? offset : -1;
+        }
+    }
+}
+";
+            var assembly = CompileToAssembly(generatedCode + "\n" + structDef, "TemplatePrimitiveAssembly");
+            var generatedType = assembly.GetType("TestNamespace.TemplatePrimitive")!;
+            var helper = assembly.GetType("TestNamespace.TemplateTestHelper")!;
+
+            var instance = Activator.CreateInstance(generatedType)!;
+            generatedType.GetField("Id")!.SetValue(instance, 1);
+            generatedType.GetField("Flag")!.SetValue(instance, (byte)0x7F);
+            generatedType.GetField("Value")!.SetValue(instance, 2.5);
+            generatedType.GetField("Name")!.SetValue(instance, "n");
+
+            var getOffset = helper.GetMethod("GetOffset")!;
+            var serialize = helper.GetMethod("SerializeWithHeader")!;
+
+            foreach (bool xcdr2 in new[] { false, true })
+            {
+                var buffer = (byte[])serialize.Invoke(null, new object[] { instance, xcdr2 })!;
+
+                int flagOffset = (int)getOffset.Invoke(null, new object[] { "Flag", xcdr2 })!;
+                int valueOffset = (int)getOffset.Invoke(null, new object[] { "Value", xcdr2 })!;
+
+                Assert.Equal(0x7F, buffer[flagOffset]);
+                Assert.Equal(2.5, BitConverter.ToDouble(buffer, valueOffset));
+
+                // Key members and members after a variable-size one are not patchable
+                Assert.Equal(-1, (int)getOffset.Invoke(null, new object[] { "Id", xcdr2 })!);
+                Assert.Equal(-1, (int)getOffset.Invoke(null, new object[] { "After", xcdr2 })!);
+            }
+
+            // XCDR2 adds the DHEADER and caps alignment at 4
+            Assert.Equal(16, (int)getOffset.Invoke(null, new object[] { "Value", true })!);
+            Assert.Equal(12, (int)getOffset.Invoke(null, new object[] { "Value", false })!);
+        }
+
+        [Fact]
+        public void GeneratedCode_ContentEquals_ComparesLikeSerializedBytes()
+        {
+            var type = new TypeInfo
+            {
+                Name = "EqualityPrimitive",
+                Namespace = "TestNamespace",
+                Fields = new List<FieldInfo>
+                {
+                    new FieldInfo { Name = "Id", TypeName = "int" },
+                    new FieldInfo { Name = "Value", TypeName = "double" },
+                    new FieldInfo { Name = "Name", TypeName = "string", Attributes = new List<AttributeInfo> { new AttributeInfo { Name = "DdsManaged" } } },
+                    new FieldInfo { Name = "Samples", TypeName = "List<int>", Attributes = new List<AttributeInfo> { new AttributeInfo { Name = "DdsManaged" } } }
+                }
+            };
+
+            string generatedCode = new SerializerEmitter().EmitSerializer(type, new GlobalTypeRegistry());
+
+            string structDef = @"
+namespace TestNamespace
+{
+    public partial struct EqualityPrimitive
+    {
+        public int Id;
+        public double Value;
+        public string Name;
+        public System.Collections.Generic.List<int> Samples;
+    }
+
+    public static class EqualityTestHelper
+    {
+        public static EqualityPrimitive Create(int id, double value, string name, int[] samples)
+        {
+            return new EqualityPrimitive { Id = id, Value = value, Name = name, Samples = new System.Collections.Generic.List<int>(samples) };
+        }
+
+        public static bool AreEqual(object a, object b) => ((EqualityPrimitive)a).ContentEquals((EqualityPrimitive)b);
+    }
+}
+";
+            string code = "using System.Collections.Generic;\n" + generatedCode + "\n" + structDef;
+            var assembly = CompileToAssembly(code, "EqualityPrimitiveAssembly");
+            var helper = assembly.GetType("TestNamespace.EqualityTestHelper")!;
+            var create = helper.GetMethod("Create")!;
+            var areEqual = helper.GetMethod("AreEqual")!;
+
+            object Make(int id, double value, string name, int[] samples) => create.Invoke(null, new object[] { id, value, name, samples })!;
+            bool Equal(object a, object b) => (bool)areEqual.Invoke(null, new[] { a, b })!;
+
+            var baseline = Make(1, 2.5, "a", new[] { 1, 2, 3 });
+            Assert.True(Equal(baseline, Make(1, 2.5, "a", new[] { 1, 2, 3 })));
+            Assert.False(Equal(baseline, Make(2, 2.5, "a", new[] { 1, 2, 3 })));
+            Assert.False(Equal(baseline, Make(1, 2.5, "b", new[] { 1, 2, 3 })));
+            Assert.False(Equal(baseline, Make(1, 2.5, "a", new[] { 1, 2, 4 })));
+            Assert.False(Equal(baseline, Make(1, 2.5, "a", new[] { 1, 2 })));
+
+            // Bitwise, as serialized: NaN equals itself, -0.0 differs from 0.0
+            Assert.True(Equal(Make(1, double.NaN, "a", new int[0]), Make(1, double.NaN, "a", new int[0])));
+            Assert.False(Equal(Make(1, 0.0, "a", new int[0]), Make(1, -0.0, "a", new int[0])));
+        }
+
         private Assembly CompileToAssembly(string code, string assemblyName)
         {
             var tree = CSharpSyntaxTree.ParseText(code);
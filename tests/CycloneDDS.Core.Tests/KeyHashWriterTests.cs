@@ -0,0 +1,68 @@
+using System;
+using System.Security.Cryptography;
+using Xunit;
+using CycloneDDS.Core;
+
+namespace CycloneDDS.Core.Tests
+{
+    public class KeyHashWriterTests
+    {
+        [Fact]
+        public void WriteInt32_IsBigEndian_PaddedTo16()
+        {
+            var writer = new KeyHashWriter(stackalloc byte[16]);
+            writer.WriteInt32(0x12345678);
+
+            var hash = new byte[16];
+            writer.Complete(hash, useMd5: false);
+
+            var expected = new byte[16];
+            expected[0] = 0x12; expected[1] = 0x34; expected[2] = 0x56; expected[3] = 0x78;
+            Assert.Equal(expected, hash);
+        }
+
+        [Fact]
+        public void Align_CappedAt4()
+        {
+            var writer = new KeyHashWriter(stackalloc byte[16]);
+            writer.WriteByte(1);
+            writer.Align(8);
+            Assert.Equal(4, writer.Position);
+
+            writer.WriteInt64(1);
+            Assert.Equal(12, writer.Position);
+        }
+
+        [Fact]
+        public void WriteString_IncludesNul()
+        {
+            var writer = new KeyHashWriter(stackalloc byte[16]);
+            writer.WriteString("ab");
+
+            Assert.Equal(new byte[] { 0, 0, 0, 3, (byte)'a', (byte)'b', 0 }, writer.WrittenSpan.ToArray());
+        }
+
+        [Fact]
+        public void Complete_WithMd5_HashesStream()
+        {
+            var writer = new KeyHashWriter(stackalloc byte[4]);
+            writer.WriteString("a key longer than the scratch buffer");
+            byte[] stream = writer.WrittenSpan.ToArray();
+
+            var hash = new byte[16];
+            writer.Complete(hash, useMd5: true);
+
+            Assert.Equal(MD5.HashData(stream), hash);
+        }
+
+        [Fact]
+        public void Complete_ShortDestination_Throws()
+        {
+            Assert.Throws<ArgumentException>(() =>
+            {
+                var writer = new KeyHashWriter(stackalloc byte[16]);
+                writer.Complete(new byte[8], useMd5: false);
+            });
+        }
+    }
+}
@@ -0,0 +1,15 @@
+using CycloneDDS.Schema;
+
+namespace CycloneDDS.Runtime.Benchmarks
+{
+    [DdsTopic("BenchMessage")]
+    [DdsExtensibility(DdsExtensibilityKind.Final)]
+    public partial struct BenchMessage
+    {
+        [DdsKey] public int Id;
+        public long Sequence;
+        public double X;
+        public double Y;
+        public double Z;
+    }
+}
@@ -0,0 +1,120 @@
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Threading;
+using System.Threading.Tasks;
+
+namespace CycloneDDS.Runtime.Benchmarks
+{
+    /// <summary>
+    /// Write-to-consumer latency of <see cref="DdsReader{T, TView}.WaitDataAsync"/> followed by a take, versus
+    /// the listener-fed channel from <see cref="DdsReader{T, TView}.OpenChannel"/> and the inline
+    /// <see cref="DdsReader{T, TView}.OnSamples"/> handler. One sample in flight at a time,
+    /// stamped with <see cref="Stopwatch.GetTimestamp"/> on write.
+    /// </summary>
+    public static class ChannelWakeupBenchmark
+    {
+        public static void Run(TimeSpan duration)
+        {
+            Console.WriteLine($"== Reader wakeup: write-to-consumer latency (us) over {duration.TotalSeconds:0.#} s ==");
+            Console.WriteLine($"{"mode",14} {"samples",9} {"mean",8} {"p50",8} {"p99",8}");
+
+            using var participant = new DdsParticipant(domainId: 0);
+
+            Report("WaitDataAsync", Measure(participant, duration, Mode.WaitData));
+            Report("channel", Measure(participant, duration, Mode.Channel));
+            Report("inline", Measure(participant, duration, Mode.Inline));
+        }
+
+        private enum Mode { WaitData, Channel, Inline }
+
+        private static List<double> Measure(DdsParticipant participant, TimeSpan duration, Mode mode)
+        {
+            string topicName = "BenchWakeup_" + Guid.NewGuid();
+            using var writer = new DdsWriter<BenchMessage>(participant, topicName);
+            using var reader = new DdsReader<BenchMessage, BenchMessage>(participant, topicName);
+            using var received = new SemaphoreSlim(0);
+            using var cts = new CancellationTokenSource();
+
+            var latencies = new List<double>(capacity: 1 << 16);
+            bool recording = false;
+
+            void OnSample(in BenchMessage sample)
+            {
+                double us = (Stopwatch.GetTimestamp() - sample.Sequence) * 1_000_000.0 / Stopwatch.Frequency;
+                if (Volatile.Read(ref recording)) latencies.Add(us);
+                received.Release();
+            }
+
+            var consumer = mode switch
+            {
+                Mode.Channel => Task.Run(async () =>
+                {
+                    var channel = reader.OpenChannel(capacity: 16);
+                    await foreach (var sample in channel.ReadAllAsync(cts.Token)) OnSample(sample);
+                }),
+                Mode.Inline => Task.Run(() =>
+                {
+                    reader.OnSamples((in ViewScope<BenchMessage> samples) =>
+                    {
+                        foreach (var sample in samples) OnSample(sample);
+                    });
+                }),
+                _ => Task.Run(async () =>
+                {
+                    while (!cts.IsCancellationRequested)
+                    {
+                        await reader.WaitDataAsync(cts.Token);
+                        Drain(reader, OnSample);
+                    }
+                }),
+            };
+
+            Thread.Sleep(100); // let the consumer attach its listener
+
+            var ping = new BenchMessage { Id = 1, X = 1, Y = 2, Z = 3 };
+            var sw = Stopwatch.StartNew();
+            var warmup = TimeSpan.FromMilliseconds(Math.Min(500, duration.TotalMilliseconds / 4));
+            while (sw.Elapsed < duration + warmup)
+            {
+                if (sw.Elapsed >= warmup) Volatile.Write(ref recording, true);
+
+                ping.Sequence = Stopwatch.GetTimestamp();
+                writer.Write(ping);
+                if (!received.Wait(1000)) break;
+            }
+
+            cts.Cancel();
+            if (mode == Mode.Inline) reader.OnSamples(null);
+            try { consumer.Wait(1000); } catch (AggregateException) { }
+            return latencies;
+        }
+
+        private delegate void SampleAction(in BenchMessage sample);
+
+        // ViewScope is a ref struct and cannot live in the async consumer
+        private static void Drain(DdsReader<BenchMessage, BenchMessage> reader, SampleAction onSample)
+        {
+            using var scope = reader.Take();
+            foreach (var sample in scope) onSample(sample);
+        }
+
+        private static void Report(string mode, List<double> latencies)
+        {
+            if (latencies.Count == 0)
+            {
+                Console.WriteLine($"{mode,14} {"no samples",9}");
+                return;
+            }
+
+            latencies.Sort();
+            double mean = 0;
+            foreach (var l in latencies) mean += l;
+            mean /= latencies.Count;
+
+            double p50 = latencies[latencies.Count / 2];
+            double p99 = latencies[Math.Min(latencies.Count - 1, (int)(latencies.Count * 0.99))];
+            Console.WriteLine($"{mode,14} {latencies.Count,9:N0} {mean,8:0.0} {p50,8:0.0} {p99,8:0.0}");
+        }
+    }
+}
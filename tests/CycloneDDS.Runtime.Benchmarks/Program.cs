@@ -0,0 +1,39 @@
+using System;
+using System.Collections.Generic;
+
+namespace CycloneDDS.Runtime.Benchmarks
+{
+    /// <summary>
+    /// Throughput/latency measurements that are too slow or too machine-dependent for the unit tests.
+    /// Run in Release: <c>dotnet run -c Release -- [benchmark] [seconds]</c>.
+    /// </summary>
+    public static class Program
+    {
+        private static readonly Dictionary<string, Action<TimeSpan>> Benchmarks = new(StringComparer.OrdinalIgnoreCase)
+        {
+            ["sharded"] = ShardedWriterBenchmark.Run,
+            ["wakeup"] = ChannelWakeupBenchmark.Run,
+        };
+
+        public static int Main(string[] args)
+        {
+            string name = args.Length > 0 ? args[0] : "all";
+            var duration = TimeSpan.FromSeconds(args.Length > 1 ? double.Parse(args[1]) : 2);
+
+            if (name == "all")
+            {
+                foreach (var benchmark in Benchmarks.Values) benchmark(duration);
+                return 0;
+            }
+
+            if (!Benchmarks.TryGetValue(name, out var run))
+            {
+                Console.WriteLine($"Unknown benchmark '{name}'. Available: all, {string.Join(", ", Benchmarks.Keys)}");
+                return 1;
+            }
+
+            run(duration);
+            return 0;
+        }
+    }
+}
@@ -0,0 +1,87 @@
+using System;
+using System.Diagnostics;
+using System.Threading;
+
+namespace CycloneDDS.Runtime.Benchmarks
+{
+    /// <summary>
+    /// Publish throughput of one <see cref="DdsWriter{T}"/> shared by N threads versus a
+    /// <see cref="ShardedWriter{T}"/> with one shard per thread. Each thread writes its own range of keys.
+    /// </summary>
+    public static class ShardedWriterBenchmark
+    {
+        private const int KeysPerThread = 256;
+
+        public static void Run(TimeSpan duration)
+        {
+            Console.WriteLine($"== ShardedWriter: samples/s over {duration.TotalSeconds:0.#} s ({Environment.ProcessorCount} cores) ==");
+            Console.WriteLine($"{"threads",8} {"single writer",15} {"sharded",15} {"speedup",8}");
+
+            using var participant = new DdsParticipant(domainId: 0);
+
+            foreach (int threads in new[] { 1, 2, 4, 8 })
+            {
+                double single;
+                using (var writer = new DdsWriter<BenchMessage>(participant, "BenchSingle_" + Guid.NewGuid()))
+                {
+                    single = Measure(threads, duration, (in BenchMessage s) => writer.Write(s));
+                }
+
+                double sharded;
+                using (var writer = new ShardedWriter<BenchMessage>(participant, "BenchSharded_" + Guid.NewGuid(), threads))
+                {
+                    sharded = Measure(threads, duration, (in BenchMessage s) => writer.Write(s));
+                }
+
+                Console.WriteLine($"{threads,8} {single,15:N0} {sharded,15:N0} {sharded / single,7:0.00}x");
+            }
+        }
+
+        private delegate void WriteAction(in BenchMessage sample);
+
+        private static double Measure(int threads, TimeSpan duration, WriteAction write)
+        {
+            // Warm-up: JIT, serializer caches, native instance tables
+            var warmup = new BenchMessage();
+            for (int i = 0; i < threads * KeysPerThread; i++)
+            {
+                warmup.Id = i;
+                write(warmup);
+            }
+
+            long total = 0;
+            using var start = new ManualResetEventSlim(false);
+            var stop = false;
+            var workers = new Thread[threads];
+
+            for (int t = 0; t < threads; t++)
+            {
+                int firstKey = t * KeysPerThread;
+                workers[t] = new Thread(() =>
+                {
+                    var sample = new BenchMessage { X = 1, Y = 2, Z = 3 };
+                    long count = 0;
+                    start.Wait();
+                    while (!Volatile.Read(ref stop))
+                    {
+                        sample.Id = firstKey + (int)(count % KeysPerThread);
+                        sample.Sequence = count;
+                        write(sample);
+                        count++;
+                    }
+                    Interlocked.Add(ref total, count);
+                }) { IsBackground = true };
+                workers[t].Start();
+            }
+
+            var sw = Stopwatch.StartNew();
+            start.Set();
+            Thread.Sleep(duration);
+            Volatile.Write(ref stop, true);
+            foreach (var worker in workers) worker.Join();
+            sw.Stop();
+
+            return total / sw.Elapsed.TotalSeconds;
+        }
+    }
+}
@@ -0,0 +1,80 @@
+using System;
+using System.Linq;
+using System.Threading;
+using System.Threading.Tasks;
+using Xunit;
+using CycloneDDS.Runtime;
+using CycloneDDS.Runtime.Interop;
+
+namespace CycloneDDS.Runtime.Tests
+{
+    [Collection("DDS Test Collection")]
+    public class AcknowledgmentTests : IDisposable
+    {
+        private readonly DdsParticipant _participant;
+
+        public AcknowledgmentTests()
+        {
+            _participant = new DdsParticipant(domainId: 0);
+        }
+
+        public void Dispose()
+        {
+            _participant.Dispose();
+        }
+
+        [Fact]
+        public async Task WaitForAcknowledgments_NoReaders_CompletesImmediately()
+        {
+            using var writer = new DdsWriter<TestMessage>(_participant, "Acks_" + Guid.NewGuid());
+            writer.Write(new TestMessage { Id = 1 });
+
+            Assert.True(await writer.WaitForAcknowledgmentsAsync(TimeSpan.FromSeconds(1)));
+        }
+
+        [Fact]
+        public async Task WaitForAcknowledgments_ZeroTimeout_OnlyChecks()
+        {
+            using var writer = new DdsWriter<TestMessage>(_participant, "AcksZero_" + Guid.NewGuid());
+            writer.Write(new TestMessage { Id = 1 });
+
+            Assert.True(await writer.WaitForAcknowledgmentsAsync(TimeSpan.Zero));
+            Assert.True(await writer.WaitForAcknowledgmentsAsync());
+            Assert.Throws<ArgumentOutOfRangeException>(() => { writer.WaitForAcknowledgmentsAsync(TimeSpan.FromSeconds(-2)); });
+        }
+
+        [Fact]
+        public async Task SendBulkAsync_DeliversEverySampleToReliableReader()
+        {
+            string topicName = "BulkAcks_" + Guid.NewGuid();
+            var qos = DdsApi.dds_create_qos();
+            DdsApi.dds_qset_reliability(qos, DdsApi.DDS_RELIABILITY_RELIABLE, 1_000_000_000);
+            DdsApi.dds_qset_history(qos, DdsApi.DDS_HISTORY_KEEP_ALL, 0);
+
+            using var reader = new DdsReader<TestMessage, TestMessage>(_participant, topicName, qos);
+            using var writer = new DdsWriter<TestMessage>(_participant, topicName, qos);
+            DdsApi.dds_delete_qos(qos);
+            Assert.True(await writer.WaitForReaderAsync(TimeSpan.FromSeconds(2)));
+
+            const int Total = 1000;
+            long written = await writer.SendBulkAsync(
+                Enumerable.Range(0, Total).Select(i => new TestMessage { Id = i, Value = i * 2 }),
+                window: 100, ackTimeout: TimeSpan.FromSeconds(5));
+            Assert.Equal(Total, written);
+
+            int received = 0;
+            int expectedId = 0;
+            using var cts = new CancellationTokenSource(5000);
+            while (received < Total && await reader.WaitDataAsync(cts.Token))
+            {
+                using var scope = reader.Take();
+                for (int i = 0; i < scope.Count; i++)
+                {
+                    Assert.Equal(expectedId++, scope[i].Id);
+                    received++;
+                }
+            }
+            Assert.Equal(Total, received);
+        }
+    }
+}
@@ -0,0 +1,124 @@
+using System;
+using System.Threading;
+using System.Threading.Tasks;
+using Xunit;
+using CycloneDDS.Runtime;
+
+namespace CycloneDDS.Runtime.Tests
+{
+    [Collection("DDS Test Collection")]
+    public class AsyncDdsWriterTests : IDisposable
+    {
+        private readonly DdsParticipant _participant;
+
+        public AsyncDdsWriterTests()
+        {
+            _participant = new DdsParticipant(domainId: 0);
+        }
+
+        public void Dispose()
+        {
+            _participant.Dispose();
+        }
+
+        [Fact]
+        public void Enqueue_FromSeveralProducers_AllWritten()
+        {
+            string topicName = "AsyncWriter_" + Guid.NewGuid();
+            using var writer = new DdsWriter<TestMessage>(_participant, topicName);
+            using var reader = new DdsReader<TestMessage, TestMessage>(_participant, topicName);
+            using var asyncWriter = new AsyncDdsWriter<TestMessage>(writer, capacity: 64);
+
+            const int producers = 4;
+            const int perProducer = 250;
+            Parallel.For(0, producers, p =>
+            {
+                for (int i = 0; i < perProducer; i++)
+                {
+                    Assert.True(asyncWriter.Enqueue(new TestMessage { Id = p, Value = i }));
+                }
+            });
+
+            Assert.True(asyncWriter.WaitForDrain(TimeSpan.FromSeconds(5)));
+            Assert.Equal(producers * perProducer, asyncWriter.Enqueued);
+            Assert.Equal(producers * perProducer, asyncWriter.Written);
+            Assert.Equal(0, asyncWriter.Dropped);
+            Assert.Equal(0, asyncWriter.Failed);
+            Assert.InRange(asyncWriter.MaxQueueDepth, 1, asyncWriter.Capacity);
+
+            Assert.True(reader.WaitDataAsync(new CancellationTokenSource(2000).Token).GetAwaiter().GetResult());
+        }
+
+        [Fact]
+        public void DropNewest_WhenFull_ReturnsFalse()
+        {
+            using var writer = new DdsWriter<TestMessage>(_participant, "AsyncDropNewest_" + Guid.NewGuid());
+            using var asyncWriter = new AsyncDdsWriter<TestMessage>(writer, capacity: 2, overflow: AsyncWriterOverflowPolicy.DropNewest);
+
+            int accepted = 0;
+            for (int i = 0; i < 10_000; i++)
+            {
+                if (asyncWriter.Enqueue(new TestMessage { Id = i, Value = i })) accepted++;
+            }
+
+            Assert.True(asyncWriter.WaitForDrain(TimeSpan.FromSeconds(5)));
+            Assert.Equal(10_000, accepted + asyncWriter.Dropped);
+            Assert.Equal(accepted, asyncWriter.Written);
+        }
+
+        [Fact]
+        public void DropOldest_AlwaysAccepts()
+        {
+            using var writer = new DdsWriter<TestMessage>(_participant, "AsyncDropOldest_" + Guid.NewGuid());
+            using var asyncWriter = new AsyncDdsWriter<TestMessage>(writer, capacity: 2, overflow: AsyncWriterOverflowPolicy.DropOldest);
+
+            for (int i = 0; i < 10_000; i++)
+            {
+                Assert.True(asyncWriter.Enqueue(new TestMessage { Id = i, Value = i }));
+            }
+
+            Assert.True(asyncWriter.WaitForDrain(TimeSpan.FromSeconds(5)));
+            Assert.Equal(10_000, asyncWriter.Written + asyncWriter.Dropped);
+        }
+
+        [Fact]
+        public void Enqueue_AfterDispose_Throws()
+        {
+            using var writer = new DdsWriter<TestMessage>(_participant, "AsyncDisposed_" + Guid.NewGuid());
+            var asyncWriter = new AsyncDdsWriter<TestMessage>(writer);
+            asyncWriter.Dispose();
+
+            Assert.Throws<ObjectDisposedException>(() => asyncWriter.Enqueue(new TestMessage()));
+        }
+
+        [Fact]
+        public void Dispose_DuringEnqueue_WritesEveryAcceptedSample()
+        {
+            using var writer = new DdsWriter<TestMessage>(_participant, "AsyncDisposeRace_" + Guid.NewGuid());
+            var asyncWriter = new AsyncDdsWriter<TestMessage>(writer, capacity: 64);
+
+            var producers = new Task[4];
+            for (int p = 0; p < producers.Length; p++)
+            {
+                int id = p;
+                producers[p] = Task.Run(() =>
+                {
+                    try
+                    {
+                        while (true) asyncWriter.Enqueue(new TestMessage { Id = id });
+                    }
+                    catch (ObjectDisposedException)
+                    {
+                    }
+                });
+            }
+
+            Thread.Sleep(20);
+            asyncWriter.Dispose();
+            Assert.True(Task.WaitAll(producers, 5000));
+
+            Assert.Equal(asyncWriter.Enqueued, asyncWriter.Written + asyncWriter.Failed);
+            Assert.Equal(0, asyncWriter.QueueDepth);
+        }
+    }
+}
@@ -0,0 +1,182 @@
+using System;
+using System.Buffers;
+using System.Buffers.Binary;
+using System.IO;
+using System.Threading;
+using System.Threading.Tasks;
+using Xunit;
+using CycloneDDS.Runtime;
+using CycloneDDS.Runtime.Blobs;
+
+namespace CycloneDDS.Runtime.Tests
+{
+    [Collection("DDS Test Collection")]
+    public class BlobChannelTests : IDisposable
+    {
+        private readonly DdsParticipant _participant;
+
+        public BlobChannelTests()
+        {
+            _participant = new DdsParticipant(domainId: 0);
+        }
+
+        public void Dispose()
+        {
+            _participant.Dispose();
+        }
+
+        private static byte[] CreateBlob(int length)
+        {
+            var data = new byte[length];
+            new Random(42).NextBytes(data);
+            return data;
+        }
+
+        [Fact]
+        public async Task Sequence_ReassemblesIntoPooledSegments()
+        {
+            string channelName = "Blob_" + Guid.NewGuid().ToString("N");
+            using var sender = new BlobChannel(_participant, channelName, chunkSize: 16 * 1024, window: 4);
+            using var receiver = new BlobChannel(_participant, channelName);
+
+            // Not a multiple of the chunk size, and spans two receive segments
+            byte[] blob = CreateBlob(BlobBuffer.SegmentSize + 12345);
+
+            using var cts = new CancellationTokenSource(TimeSpan.FromSeconds(20));
+            var receive = receiver.ReceiveAsync(cancellationToken: cts.Token);
+            long transferId = await sender.SendAsync(new ReadOnlySequence<byte>(blob), cancellationToken: cts.Token);
+
+            using var received = await receive;
+            Assert.Equal(transferId, received.TransferId);
+            Assert.Equal(blob.Length, received.Length);
+            Assert.True(received.AsSequence().ToArray().AsSpan().SequenceEqual(blob));
+        }
+
+        [Fact]
+        public async Task Stream_ReassemblesIntoMemoryMappedFile()
+        {
+            string channelName = "BlobFile_" + Guid.NewGuid().ToString("N");
+            string path = Path.Combine(Path.GetTempPath(), channelName + ".bin");
+            using var sender = new BlobChannel(_participant, channelName, chunkSize: 8 * 1024, window: 8);
+            using var receiver = new BlobChannel(_participant, channelName);
+
+            byte[] blob = CreateBlob(200_000);
+            long lastReported = 0;
+            var progress = new SynchronousProgress(p => lastReported = p.BytesTransferred);
+
+            try
+            {
+                using var cts = new CancellationTokenSource(TimeSpan.FromSeconds(20));
+                var receive = receiver.ReceiveToFileAsync(path, cancellationToken: cts.Token);
+                await sender.SendAsync(new MemoryStream(blob), progress, cts.Token);
+
+                Assert.Equal(blob.Length, await receive);
+                Assert.Equal(blob.Length, lastReported);
+                Assert.Equal(blob, File.ReadAllBytes(path));
+            }
+            finally
+            {
+                File.Delete(path);
+            }
+        }
+
+        [Fact]
+        public async Task EmptyBlob_IsReceivedAsEmptySequence()
+        {
+            string channelName = "BlobEmpty_" + Guid.NewGuid().ToString("N");
+            using var sender = new BlobChannel(_participant, channelName);
+            using var receiver = new BlobChannel(_participant, channelName);
+
+            using var cts = new CancellationTokenSource(TimeSpan.FromSeconds(20));
+            var receive = receiver.ReceiveAsync(cancellationToken: cts.Token);
+            long transferId = await sender.SendAsync(ReadOnlySequence<byte>.Empty, cancellationToken: cts.Token);
+
+            using var received = await receive;
+            Assert.Equal(transferId, received.TransferId);
+            Assert.Equal(0, received.Length);
+            Assert.True(received.AsSequence().IsEmpty);
+        }
+
+        [Fact]
+        public async Task EmptyBlob_IsReceivedAsEmptyFile()
+        {
+            string channelName = "BlobEmptyFile_" + Guid.NewGuid().ToString("N");
+            string path = Path.Combine(Path.GetTempPath(), channelName + ".bin");
+            using var sender = new BlobChannel(_participant, channelName);
+            using var receiver = new BlobChannel(_participant, channelName);
+
+            try
+            {
+                using var cts = new CancellationTokenSource(TimeSpan.FromSeconds(20));
+                var receive = receiver.ReceiveToFileAsync(path, cancellationToken: cts.Token);
+                await sender.SendAsync(new MemoryStream(), cancellationToken: cts.Token);
+
+                Assert.Equal(0, await receive);
+                Assert.True(File.Exists(path));
+                Assert.Equal(0, new FileInfo(path).Length);
+            }
+            finally
+            {
+                File.Delete(path);
+            }
+        }
+
+        [Fact]
+        public async Task FailedSend_IsAbortedAndReceiverTakesTheNextTransfer()
+        {
+            string channelName = "BlobAbort_" + Guid.NewGuid().ToString("N");
+            using var sender = new BlobChannel(_participant, channelName, chunkSize: 1024, window: 4);
+            using var receiver = new BlobChannel(_participant, channelName);
+
+            using var cts = new CancellationTokenSource(TimeSpan.FromSeconds(20));
+            var receive = receiver.ReceiveAsync(cancellationToken: cts.Token);
+
+            // The stream breaks after three chunks
+            var broken = new MemoryStream(CreateBlob(3 * 1024));
+            await Assert.ThrowsAsync<EndOfStreamException>(() => sender.SendAsync(broken, 8 * 1024, cancellationToken: cts.Token));
+
+            byte[] blob = CreateBlob(5000);
+            long transferId = await sender.SendAsync(new ReadOnlySequence<byte>(blob), cancellationToken: cts.Token);
+
+            using var received = await receive;
+            Assert.Equal(transferId, received.TransferId);
+            Assert.True(received.AsSequence().ToArray().AsSpan().SequenceEqual(blob));
+        }
+
+        [Fact]
+        public async Task BigEndianChunk_IsByteSwapped()
+        {
+            string channelName = "BlobBE_" + Guid.NewGuid().ToString("N");
+            using var receiver = new BlobChannel(_participant, channelName);
+            using var cts = new CancellationTokenSource(TimeSpan.FromSeconds(20));
+            var receive = receiver.ReceiveAsync(cancellationToken: cts.Token);
+
+            using var writer = new DdsWriter<BlobChunk>(_participant, channelName);
+            Assert.True(await writer.WaitForReaderAsync(TimeSpan.FromSeconds(5)));
+
+            byte[] payload = CreateBlob(100);
+            var cdr = new byte[4 + 36 + payload.Length];
+            cdr[1] = 0x00; // CDR_BE
+            var header = cdr.AsSpan(4);
+            BinaryPrimitives.WriteInt64BigEndian(header.Slice(0), 77);             // TransferId
+            BinaryPrimitives.WriteInt32BigEndian(header.Slice(8), 0);              // ChunkIndex
+            BinaryPrimitives.WriteInt32BigEndian(header.Slice(12), 1);             // ChunkCount
+            BinaryPrimitives.WriteInt64BigEndian(header.Slice(16), payload.Length); // TotalLength
+            BinaryPrimitives.WriteInt64BigEndian(header.Slice(24), 0);             // Offset
+            BinaryPrimitives.WriteUInt32BigEndian(header.Slice(32), (uint)payload.Length);
+            payload.CopyTo(header.Slice(36));
+            writer.WriteRaw(cdr);
+
+            using var received = await receive;
+            Assert.Equal(77, received.TransferId);
+            Assert.True(received.AsSequence().ToArray().AsSpan().SequenceEqual(payload));
+        }
+
+        private sealed class SynchronousProgress : IProgress<BlobTransferProgress>
+        {
+            private readonly Action<BlobTransferProgress> _report;
+            public SynchronousProgress(Action<BlobTransferProgress> report) => _report = report;
+            public void Report(BlobTransferProgress value) => _report(value);
+        }
+    }
+}
@@ -0,0 +1,123 @@
+using System;
+using System.Collections.Generic;
+using System.Threading;
+using Xunit;
+using CycloneDDS.Core;
+using CycloneDDS.Runtime;
+
+namespace CycloneDDS.Runtime.Tests
+{
+    [Collection("DDS Test Collection")]
+    public class ConflatingWriterTests : IDisposable
+    {
+        private readonly DdsParticipant _participant;
+
+        public ConflatingWriterTests()
+        {
+            _participant = new DdsParticipant(domainId: 0);
+        }
+
+        public void Dispose()
+        {
+            _participant.Dispose();
+        }
+
+        [Fact]
+        public void Flush_WritesLatestValuePerInstance()
+        {
+            string topicName = "Conflating_" + Guid.NewGuid();
+            using var writer = new DdsWriter<KeyedTestMessage>(_participant, topicName);
+            using var reader = new DdsReader<KeyedTestMessage, KeyedTestMessage>(_participant, topicName);
+            using var conflating = new ConflatingWriter<KeyedTestMessage>(writer, TimeSpan.Zero, capacity: 16);
+
+            for (int i = 0; i < 1000; i++)
+            {
+                conflating.Update(new KeyedTestMessage { Id = i % 3, Value = i, Message = "c" });
+            }
+
+            Assert.Equal(3, conflating.InstanceCount);
+            Assert.Equal(3, conflating.Flush());
+            Assert.Equal(0, conflating.Flush());
+
+            Assert.True(reader.WaitDataAsync(new CancellationTokenSource(2000).Token).GetAwaiter().GetResult());
+            Thread.Sleep(100);
+            using var scope = reader.Take();
+            Assert.Equal(3, scope.Count);
+            for (int i = 0; i < scope.Count; i++)
+            {
+                // Last update of key k is 997 + k
+                Assert.Equal(997 + scope[i].Id, scope[i].Value);
+            }
+        }
+
+        [Fact]
+        public void BackgroundFlush_PublishesAtInterval()
+        {
+            string topicName = "ConflatingTimer_" + Guid.NewGuid();
+            using var writer = new DdsWriter<KeyedTestMessage>(_participant, topicName);
+            using var reader = new DdsReader<KeyedTestMessage, KeyedTestMessage>(_participant, topicName);
+            using var conflating = new ConflatingWriter<KeyedTestMessage>(writer, TimeSpan.FromMilliseconds(20));
+
+            conflating.Update(new KeyedTestMessage { Id = 7, Value = 1.5, Message = "t" });
+
+            Assert.True(reader.WaitDataAsync(new CancellationTokenSource(2000).Token).GetAwaiter().GetResult());
+            using var scope = reader.Take();
+            Assert.Equal(1, scope.Count);
+            Assert.Equal(7, scope[0].Id);
+        }
+
+        [Fact]
+        public void FullTable_WritesThrough()
+        {
+            string topicName = "ConflatingFull_" + Guid.NewGuid();
+            using var writer = new DdsWriter<KeyedTestMessage>(_participant, topicName);
+            using var reader = new DdsReader<KeyedTestMessage, KeyedTestMessage>(_participant, topicName);
+            using var conflating = new ConflatingWriter<KeyedTestMessage>(writer, TimeSpan.Zero, capacity: 1);
+
+            conflating.Update(new KeyedTestMessage { Id = 1, Value = 1, Message = "held" });
+            conflating.Update(new KeyedTestMessage { Id = 2, Value = 2, Message = "direct" });
+
+            Assert.True(reader.WaitDataAsync(new CancellationTokenSource(2000).Token).GetAwaiter().GetResult());
+            using var scope = reader.Take();
+            Assert.Equal(1, scope.Count);
+            Assert.Equal("direct", scope[0].Message);
+        }
+
+        [Fact]
+        public void DigestMix_SpreadsSmallIntegerKeys()
+        {
+            using var writer = new DdsWriter<KeyedTestMessage>(_participant, "ConflatingMix_" + Guid.NewGuid());
+            Span<byte> digest = stackalloc byte[KeyHashWriter.HashSize];
+            var buckets = new HashSet<ulong>();
+
+            for (int id = 0; id < 64; id++)
+            {
+                writer.ComputeInstanceDigest(new KeyedTestMessage { Id = id }, digest);
+                var (lo, hi) = InstanceDigest.Read(digest);
+                buckets.Add(InstanceDigest.Mix(lo, hi) & 15);
+            }
+
+            // 64 keys over 16 buckets: a digest that only varies in its high bits would hit one bucket
+            Assert.True(buckets.Count >= 12, $"only {buckets.Count} of 16 buckets used");
+        }
+
+        [Fact]
+        public void FailedWrite_StaysDirtyAndIsCounted()
+        {
+            string topicName = "ConflatingFail_" + Guid.NewGuid();
+            var writer = new DdsWriter<KeyedTestMessage>(_participant, topicName);
+            using var conflating = new ConflatingWriter<KeyedTestMessage>(writer, TimeSpan.Zero, capacity: 16);
+
+            conflating.Update(new KeyedTestMessage { Id = 1, Value = 1, Message = "lost?" });
+            writer.Dispose();
+
+            Assert.Throws<ObjectDisposedException>(() => conflating.Flush());
+            Assert.Equal(1, conflating.FailedWrites);
+            Assert.IsType<ObjectDisposedException>(conflating.LastError);
+
+            // Still dirty: the next flush tries again
+            Assert.Throws<ObjectDisposedException>(() => conflating.Flush());
+            Assert.Equal(2, conflating.FailedWrites);
+        }
+    }
+}
@@ -45,5 +45,64 @@ namespace CycloneDDS.Runtime.Tests
             
             Assert.Throws<ObjectDisposedException>(() => writer.Write(new TestMessage()));
         }
+
+        [Fact]
+        public void Write_TrustedProducer_ReachesReader()
+        {
+            using var participant = new DdsParticipant(0);
+            using var writer = new DdsWriter<KeyedTestMessage>(participant, "TestTopic_Trusted");
+            using var reader = new DdsReader<KeyedTestMessage, KeyedTestMessage>(participant, "TestTopic_Trusted");
+
+            writer.TrustedProducer = true;
+            Assert.True(writer.TrustedProducer);
+
+            for (int i = 0; i < 100; i++)
+            {
+                writer.Write(new KeyedTestMessage { Id = i, Value = i, Message = "trusted" });
+            }
+
+            Assert.True(reader.WaitDataAsync(new System.Threading.CancellationTokenSource(2000).Token).GetAwaiter().GetResult());
+            using var scope = reader.Take();
+            Assert.True(scope.Count > 0);
+            Assert.Equal("trusted", scope[0].Message);
+        }
+
+        [Fact]
+        public void WriteIfChanged_SkipsIdenticalSamplesPerInstance()
+        {
+            using var participant = new DdsParticipant(0);
+            using var writer = new DdsWriter<KeyedTestMessage>(participant, "TestTopic_WriteIfChanged");
+            using var reader = new DdsReader<KeyedTestMessage, KeyedTestMessage>(participant, "TestTopic_WriteIfChanged");
+
+            var a = new KeyedTestMessage { Id = 1, Value = 1, Message = "same" };
+            var b = new KeyedTestMessage { Id = 2, Value = 1, Message = "same" };
+
+            Assert.True(writer.WriteIfChanged(a));
+            Assert.False(writer.WriteIfChanged(a));
+            Assert.True(writer.WriteIfChanged(b)); // same content, other instance
+            Assert.False(writer.WriteIfChanged(b));
+
+            a.Value = 2;
+            Assert.True(writer.WriteIfChanged(a));
+            Assert.False(writer.WriteIfChanged(a));
+
+            // A plain write resets the comparison
+            writer.Write(new KeyedTestMessage { Id = 1, Value = 3, Message = "other" });
+            Assert.True(writer.WriteIfChanged(a));
+
+            Assert.True(reader.WaitDataAsync(new System.Threading.CancellationTokenSource(2000).Token).GetAwaiter().GetResult());
+            System.Threading.Thread.Sleep(100);
+            using var scope = reader.Take();
+
+            // The last sample of instance 1 is the one published after the plain write
+            KeyedTestMessage? last = null;
+            for (int i = 0; i < scope.Count; i++)
+            {
+                if (scope[i].Id == 1) last = scope[i];
+            }
+            Assert.NotNull(last);
+            Assert.Equal(2, last!.Value.Value);
+            Assert.Equal("same", last.Value.Message);
+        }
     }
 }
@@ -0,0 +1,140 @@
+using System;
+using System.Threading;
+using System.Threading.Tasks;
+using Xunit;
+using CycloneDDS.Runtime;
+using CycloneDDS.Runtime.Interop;
+
+namespace CycloneDDS.Runtime.Tests
+{
+    [Collection("DDS Test Collection")]
+    public class HistoryStoreTests : IDisposable
+    {
+        private readonly DdsParticipant _participant;
+
+        public HistoryStoreTests()
+        {
+            _participant = new DdsParticipant(domainId: 0);
+        }
+
+        public void Dispose()
+        {
+            _participant.Dispose();
+        }
+
+        private DdsReader<KeyedTestMessage, KeyedTestMessage> CreateKeepAllReader(string topicName)
+        {
+            var qos = DdsApi.dds_create_qos();
+            DdsApi.dds_qset_history(qos, DdsApi.DDS_HISTORY_KEEP_ALL, 0);
+            var reader = new DdsReader<KeyedTestMessage, KeyedTestMessage>(_participant, topicName, qos);
+            DdsApi.dds_delete_qos(qos);
+            return reader;
+        }
+
+        private static void Feed(HistoryStore<KeyedTestMessage> store, int expected)
+        {
+            int total = 0;
+            var deadline = DateTime.UtcNow.AddSeconds(2);
+            while (total < expected && DateTime.UtcNow < deadline)
+            {
+                int taken = store.Poll();
+                if (taken == 0) Thread.Sleep(10);
+                total += taken;
+            }
+        }
+
+        [Fact]
+        public void Ring_KeepsNewestSamplesInTimeOrder()
+        {
+            string topicName = "History_" + Guid.NewGuid();
+            using var writer = new DdsWriter<KeyedTestMessage>(_participant, topicName);
+            using var reader = CreateKeepAllReader(topicName);
+            var store = new HistoryStore<KeyedTestMessage>(reader, capacityPerInstance: 8);
+
+            for (int n = 0; n < 20; n++)
+            {
+                writer.Write(new KeyedTestMessage { Id = 1, Value = n, Message = "h" });
+            }
+            Feed(store, 20);
+
+            var key = new KeyedTestMessage { Id = 1 };
+            using var all = store.Query(key, 0, long.MaxValue);
+            Assert.Equal(8, all.Count);
+            for (int i = 0; i < all.Count; i++)
+            {
+                Assert.Equal(12 + i, all[i].Value);
+                if (i > 0) Assert.True(all.GetTimestamp(i) >= all.GetTimestamp(i - 1));
+            }
+
+            // Range bounds are inclusive and binary searched
+            long from = all.GetTimestamp(3);
+            using var tail = store.Query(key, from, long.MaxValue);
+            Assert.True(tail.Count >= 5);
+            Assert.Equal(all.GetTimestamp(all.Count - 1), tail.GetTimestamp(tail.Count - 1));
+
+            using (var last = store.QueryLast(key, TimeSpan.FromMinutes(1))) Assert.Equal(8, last.Count);
+            using (var none = store.Query(key, 0, all.GetTimestamp(0) - 1)) Assert.True(none.IsEmpty);
+
+            var copy = new KeyedTestMessage[4];
+            var stamps = new long[4];
+            Assert.Equal(4, store.CopyRange(reader.LookupInstance(key), 0, long.MaxValue, copy, stamps));
+            Assert.Equal(12, copy[0].Value);
+        }
+
+        [Fact]
+        public void ByteLimit_RecyclesLeastRecentlyUpdatedInstance()
+        {
+            string topicName = "HistoryLimit_" + Guid.NewGuid();
+            using var writer = new DdsWriter<KeyedTestMessage>(_participant, topicName);
+            using var reader = CreateKeepAllReader(topicName);
+            var store = new HistoryStore<KeyedTestMessage>(reader, capacityPerInstance: 4,
+                maxBytes: 2 * 4 * HistoryStore<KeyedTestMessage>.SlotBytes);
+            Assert.Equal(2, store.MaxInstances);
+
+            for (int id = 1; id <= 3; id++)
+            {
+                writer.Write(new KeyedTestMessage { Id = id, Value = id, Message = "l" });
+                Feed(store, 1);
+            }
+
+            Assert.Equal(2, store.InstanceCount);
+            using (var first = store.Query(new KeyedTestMessage { Id = 1 }, 0, long.MaxValue)) Assert.True(first.IsEmpty);
+            using (var third = store.Query(new KeyedTestMessage { Id = 3 }, 0, long.MaxValue)) Assert.Equal(1, third.Count);
+
+            // Updating 2 makes 3 the least recently updated, although 2 was added first
+            writer.Write(new KeyedTestMessage { Id = 2, Value = 20, Message = "l" });
+            Feed(store, 1);
+            writer.Write(new KeyedTestMessage { Id = 4, Value = 4, Message = "l" });
+            Feed(store, 1);
+
+            using (var third = store.Query(new KeyedTestMessage { Id = 3 }, 0, long.MaxValue)) Assert.True(third.IsEmpty);
+            using (var second = store.Query(new KeyedTestMessage { Id = 2 }, 0, long.MaxValue)) Assert.Equal(2, second.Count);
+        }
+
+        [Fact]
+        public void QueryLease_HoldsOffFeedingUntilDisposed()
+        {
+            string topicName = "HistoryLease_" + Guid.NewGuid();
+            using var writer = new DdsWriter<KeyedTestMessage>(_participant, topicName);
+            using var reader = CreateKeepAllReader(topicName);
+            var store = new HistoryStore<KeyedTestMessage>(reader, capacityPerInstance: 2);
+
+            writer.Write(new KeyedTestMessage { Id = 1, Value = 1, Message = "a" });
+            Feed(store, 1);
+
+            var range = store.Query(new KeyedTestMessage { Id = 1 }, 0, long.MaxValue);
+            Assert.Equal(1, range[0].Value);
+
+            writer.Write(new KeyedTestMessage { Id = 1, Value = 2, Message = "b" });
+            writer.Write(new KeyedTestMessage { Id = 1, Value = 3, Message = "c" });
+            var feed = Task.Run(() => Feed(store, 2));
+
+            // The ring cannot be overwritten while the lease is held
+            Assert.False(feed.Wait(200));
+            Assert.Equal(1, range[0].Value);
+
+            range.Dispose();
+            Assert.True(feed.Wait(5000));
+        }
+    }
+}
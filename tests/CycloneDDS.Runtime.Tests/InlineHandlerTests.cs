@@ -0,0 +1,103 @@
+using System;
+using System.Collections.Concurrent;
+using System.Collections.Generic;
+using System.Threading;
+using Xunit;
+using CycloneDDS.Runtime;
+using CycloneDDS.Runtime.Interop;
+
+namespace CycloneDDS.Runtime.Tests
+{
+    [Collection("DDS Test Collection")]
+    public class InlineHandlerTests : IDisposable
+    {
+        private readonly DdsParticipant _participant;
+
+        public InlineHandlerTests()
+        {
+            _participant = new DdsParticipant(domainId: 0);
+        }
+
+        public void Dispose()
+        {
+            _participant.Dispose();
+        }
+
+        private DdsReader<KeyedTestMessage, KeyedTestMessage> CreateKeepAllReader(string topicName)
+        {
+            var qos = DdsApi.dds_create_qos();
+            DdsApi.dds_qset_history(qos, DdsApi.DDS_HISTORY_KEEP_ALL, 0);
+            var reader = new DdsReader<KeyedTestMessage, KeyedTestMessage>(_participant, topicName, qos);
+            DdsApi.dds_delete_qos(qos);
+            return reader;
+        }
+
+        [Fact]
+        public void OnSamples_DeliversCachedAndNewSamples_InOrder()
+        {
+            string topicName = "Inline_" + Guid.NewGuid();
+            using var writer = new DdsWriter<KeyedTestMessage>(_participant, topicName);
+            using var reader = CreateKeepAllReader(topicName);
+
+            writer.Write(new KeyedTestMessage { Id = 4, Value = 0, Message = "early" });
+            Assert.True(reader.WaitDataAsync(new CancellationTokenSource(2000).Token).GetAwaiter().GetResult());
+
+            int testThread = Environment.CurrentManagedThreadId;
+            var values = new List<double>();
+            var threads = new ConcurrentDictionary<int, bool>();
+            using var done = new ManualResetEventSlim(false);
+            const int total = 10;
+
+            reader.OnSamples((in ViewScope<KeyedTestMessage> samples) =>
+            {
+                threads[Environment.CurrentManagedThreadId] = true;
+                foreach (var sample in samples) values.Add(sample.Value);
+                if (values.Count == total) done.Set();
+            });
+
+            // The cached sample is delivered before OnSamples returns
+            Assert.Equal(new[] { 0.0 }, values);
+            Assert.True(threads.ContainsKey(testThread));
+
+            for (int i = 1; i < total; i++)
+            {
+                writer.Write(new KeyedTestMessage { Id = 4, Value = i, Message = "m" });
+            }
+
+            Assert.True(done.Wait(5000));
+            for (int i = 0; i < total; i++) Assert.Equal(i, values[i]);
+            Assert.Null(reader.LastHandlerError);
+
+            reader.OnSamples(null);
+            writer.Write(new KeyedTestMessage { Id = 4, Value = 99, Message = "after" });
+            Assert.True(reader.WaitDataAsync(new CancellationTokenSource(2000).Token).GetAwaiter().GetResult());
+            Assert.Equal(total, values.Count);
+        }
+
+        [Fact]
+        public void OnSamples_HandlerException_IsReported_AndDeliveryContinues()
+        {
+            string topicName = "Inline_" + Guid.NewGuid();
+            using var writer = new DdsWriter<KeyedTestMessage>(_participant, topicName);
+            using var reader = CreateKeepAllReader(topicName);
+
+            using var second = new ManualResetEventSlim(false);
+            reader.OnSamples((in ViewScope<KeyedTestMessage> samples) =>
+            {
+                foreach (var sample in samples)
+                {
+                    if (sample.Value == 1) throw new InvalidOperationException("boom");
+                    if (sample.Value == 2) second.Set();
+                }
+            }, maxSamplesPerTake: 1);
+
+            Assert.Throws<InvalidOperationException>(() => reader.OpenChannel());
+
+            writer.Write(new KeyedTestMessage { Id = 5, Value = 1, Message = "bad" });
+            writer.Write(new KeyedTestMessage { Id = 5, Value = 2, Message = "good" });
+
+            Assert.True(second.Wait(5000));
+            Assert.IsType<InvalidOperationException>(reader.LastHandlerError);
+        }
+    }
+}
@@ -0,0 +1,213 @@
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Threading;
+using Xunit;
+using CycloneDDS.Runtime;
+using CycloneDDS.Runtime.Interop;
+
+namespace CycloneDDS.Runtime.Tests
+{
+    [Collection("DDS Test Collection")]
+    public class InstanceCatalogTests : IDisposable
+    {
+        private readonly DdsParticipant _participant;
+
+        public InstanceCatalogTests()
+        {
+            _participant = new DdsParticipant(domainId: 0);
+        }
+
+        public void Dispose()
+        {
+            _participant.Dispose();
+        }
+
+        private static List<DdsInstanceInfo<KeyedTestMessage>> WaitForInstances(
+            DdsReader<KeyedTestMessage, KeyedTestMessage> reader, int expected,
+            DdsInstanceState states = DdsInstanceState.Alive, int batchSize = 256)
+        {
+            var deadline = DateTime.UtcNow.AddSeconds(2);
+            while (true)
+            {
+                var all = reader.GetInstances(batchSize, states).SelectMany(b => b).ToList();
+                if (all.Count >= expected || DateTime.UtcNow > deadline) return all;
+                Thread.Sleep(10);
+            }
+        }
+
+        [Fact]
+        public void GetInstances_ListsKeysInBatches_WithoutConsumingSamples()
+        {
+            string topicName = "Catalog_" + Guid.NewGuid();
+            using var writer = new DdsWriter<KeyedTestMessage>(_participant, topicName);
+            using var reader = new DdsReader<KeyedTestMessage, KeyedTestMessage>(_participant, topicName);
+
+            for (int id = 1; id <= 10; id++)
+            {
+                writer.Write(new KeyedTestMessage { Id = id, Value = id * 1.5, Message = "payload" });
+            }
+
+            var instances = WaitForInstances(reader, 10, batchSize: 4);
+            Assert.Equal(Enumerable.Range(1, 10), instances.Select(i => i.Key.Id).OrderBy(id => id));
+            Assert.All(instances, i =>
+            {
+                Assert.False(i.Handle.IsNil);
+                Assert.Equal(DdsInstanceState.Alive, i.State);
+                Assert.Equal(0.0, i.Key.Value); // only key members are decoded
+                Assert.Null(i.Key.Message);
+                Assert.Equal(i.Handle, reader.LookupInstance(i.Key));
+            });
+
+            Assert.Equal(new[] { 4, 4, 2 }, reader.GetInstances(4).Select(b => b.Length));
+
+            // Listing does not mark samples read
+            using var scope = reader.Take(32, DdsSampleState.NotRead, DdsViewState.AnyViewState, DdsInstanceState.AnyInstanceState);
+            Assert.Equal(10, scope.Count);
+        }
+
+        [Fact]
+        public void GetInstances_FiltersByInstanceState()
+        {
+            string topicName = "Catalog_" + Guid.NewGuid();
+            using var writer = new DdsWriter<KeyedTestMessage>(_participant, topicName);
+            using var reader = new DdsReader<KeyedTestMessage, KeyedTestMessage>(_participant, topicName);
+
+            writer.Write(new KeyedTestMessage { Id = 1, Value = 1, Message = "a" });
+            writer.Write(new KeyedTestMessage { Id = 2, Value = 2, Message = "b" });
+            writer.DisposeInstance(new KeyedTestMessage { Id = 2 });
+
+            var deadline = DateTime.UtcNow.AddSeconds(2);
+            var all = WaitForInstances(reader, 2, DdsInstanceState.AnyInstanceState);
+            while (!all.Any(i => i.State == DdsInstanceState.NotAliveDisposed) && DateTime.UtcNow < deadline)
+            {
+                Thread.Sleep(10);
+                all = WaitForInstances(reader, 2, DdsInstanceState.AnyInstanceState);
+            }
+
+            Assert.Equal(2, all.Count);
+            Assert.Equal(DdsInstanceState.NotAliveDisposed, all.Single(i => i.Key.Id == 2).State);
+
+            var alive = reader.GetInstances().SelectMany(b => b).ToList();
+            Assert.Equal(1, Assert.Single(alive).Key.Id);
+        }
+
+        [Fact]
+        public void GetInstances_ListsTakenInstances_InHandleOrder()
+        {
+            string topicName = "Catalog_" + Guid.NewGuid();
+            using var writer = new DdsWriter<KeyedTestMessage>(_participant, topicName);
+            using var reader = new DdsReader<KeyedTestMessage, KeyedTestMessage>(_participant, topicName);
+
+            for (int id = 1; id <= 20; id++)
+            {
+                writer.Write(new KeyedTestMessage { Id = id, Value = id, Message = "t" });
+            }
+            WaitForInstances(reader, 20);
+
+            // Alive with no samples left
+            using (var scope = reader.Take(64)) Assert.Equal(20, scope.Count);
+
+            var instances = reader.GetInstances(batchSize: 7).SelectMany(b => b).ToList();
+            Assert.Equal(Enumerable.Range(1, 20), instances.Select(i => i.Key.Id).OrderBy(id => id));
+            for (int i = 1; i < instances.Count; i++)
+            {
+                Assert.True((ulong)instances[i].Handle.Value > (ulong)instances[i - 1].Handle.Value);
+            }
+        }
+
+        [Fact]
+        public void GetInstances_ManagedSertype_DoesNotMarkSamplesRead()
+        {
+            string topicName = "CatalogManaged_" + Guid.NewGuid();
+            _participant.RegisterManagedTopic<KeyedTestMessage>(topicName);
+            using var writer = new DdsWriter<KeyedTestMessage>(_participant, topicName);
+            using var reader = new DdsReader<KeyedTestMessage, KeyedTestMessage>(_participant, topicName);
+
+            writer.Write(new KeyedTestMessage { Id = 4, Value = 1, Message = "m" });
+            writer.Write(new KeyedTestMessage { Id = 5, Value = 2, Message = "n" });
+
+            var instances = WaitForInstances(reader, 2);
+            Assert.Equal(new[] { 4, 5 }, instances.Select(i => i.Key.Id).OrderBy(id => id));
+
+            using var scope = reader.Take(32, DdsSampleState.NotRead, DdsViewState.AnyViewState, DdsInstanceState.AnyInstanceState);
+            Assert.Equal(2, scope.Count);
+        }
+
+        [Fact]
+        public void GetInstances_ManagedSertype_DecodesKeysOfTakenInstances()
+        {
+            string topicName = "CatalogManaged_" + Guid.NewGuid();
+            _participant.RegisterManagedTopic<KeyedTestMessage>(topicName);
+            using var writer = new DdsWriter<KeyedTestMessage>(_participant, topicName);
+            using var reader = new DdsReader<KeyedTestMessage, KeyedTestMessage>(_participant, topicName);
+
+            for (int id = 1; id <= 9; id++)
+            {
+                writer.Write(new KeyedTestMessage { Id = id, Value = id, Message = "k" });
+            }
+            WaitForInstances(reader, 9);
+
+            // No sample left to decode a key from: the key comes from the instance's key serdata
+            using (var scope = reader.Take(32)) Assert.Equal(9, scope.Count);
+
+            var batches = reader.GetInstances(batchSize: 4).ToList();
+            Assert.Equal(new[] { 4, 4, 1 }, batches.Select(b => b.Length));
+
+            var instances = batches.SelectMany(b => b).ToList();
+            Assert.Equal(Enumerable.Range(1, 9), instances.Select(i => i.Key.Id).OrderBy(id => id));
+            Assert.All(instances, i => Assert.Null(i.Key.Message));
+        }
+
+        [Fact]
+        public void ReadAndTakeNextInstance_VisitEachInstanceOnce()
+        {
+            string topicName = "Catalog_" + Guid.NewGuid();
+            using var writer = new DdsWriter<KeyedTestMessage>(_participant, topicName);
+            var qos = DdsApi.dds_create_qos();
+            DdsApi.dds_qset_history(qos, DdsApi.DDS_HISTORY_KEEP_ALL, 0);
+            using var reader = new DdsReader<KeyedTestMessage, KeyedTestMessage>(_participant, topicName, qos);
+            DdsApi.dds_delete_qos(qos);
+
+            for (int id = 1; id <= 5; id++)
+            {
+                writer.Write(new KeyedTestMessage { Id = id, Value = 1, Message = "x" });
+                writer.Write(new KeyedTestMessage { Id = id, Value = 2, Message = "y" });
+            }
+            WaitForInstances(reader, 5);
+
+            var visited = new List<int>();
+            var previous = DdsInstanceHandle.Nil;
+            while (true)
+            {
+                using var scope = reader.ReadNextInstance(previous);
+                if (scope.Count == 0) break;
+
+                var handle = new DdsInstanceHandle(scope.Infos[0].InstanceHandle);
+                for (int i = 0; i < scope.Count; i++)
+                {
+                    Assert.Equal(handle.Value, scope.Infos[i].InstanceHandle);
+                    Assert.Equal(scope[0].Id, scope[i].Id);
+                }
+                Assert.True((ulong)handle.Value > (ulong)previous.Value); // native handles are unsigned
+                visited.Add(scope[0].Id);
+                previous = handle;
+            }
+            Assert.Equal(Enumerable.Range(1, 5), visited.OrderBy(id => id));
+
+            int taken = 0;
+            previous = DdsInstanceHandle.Nil;
+            while (true)
+            {
+                using var scope = reader.TakeNextInstance(previous);
+                if (scope.Count == 0) break;
+                taken += scope.Count;
+                previous = new DdsInstanceHandle(scope.Infos[0].InstanceHandle);
+            }
+            Assert.Equal(10, taken);
+
+            using var rest = reader.Take();
+            Assert.Equal(0, rest.Count);
+        }
+    }
+}
@@ -2,6 +2,7 @@ using System;
 using System.Threading.Tasks;
 using Xunit;
 using CycloneDDS.Runtime;
+using CycloneDDS.Runtime.Tests.KeyedMessages;
 
 namespace CycloneDDS.Runtime.Tests
 {
@@ -207,5 +208,107 @@ namespace CycloneDDS.Runtime.Tests
              // However, for the purpose of this test ensuring no crash, this assertion is fine.
              Assert.False(handle3.IsNil);
         }
+
+        [Fact]
+        public void RegisterInstance_ReturnsLookupHandle()
+        {
+            using var writer = new DdsWriter<KeyedTestMessage>(_participant, _topicName);
+
+            var key = new KeyedTestMessage { Id = 500 };
+            var handle = writer.RegisterInstance(key);
+            Assert.False(handle.IsNil);
+
+            Assert.Equal(handle, writer.LookupInstance(key));
+            Assert.Equal(handle, writer.RegisterInstance(key));
+        }
+
+        [Fact]
+        public void WriteAndDispose_ByHandle_ReachesReader()
+        {
+            using var writer = new DdsWriter<KeyedTestMessage>(_participant, _topicName);
+            using var reader = new DdsReader<KeyedTestMessage, KeyedTestMessage>(_participant, _topicName);
+
+            var sample = new KeyedTestMessage { Id = 501, Value = 5, Message = "ByHandle" };
+            var handle = writer.RegisterInstance(sample);
+
+            writer.Write(sample, handle);
+            Assert.True(reader.WaitDataAsync(new System.Threading.CancellationTokenSource(2000).Token).GetAwaiter().GetResult());
+            using (var scope = reader.Take())
+            {
+                Assert.Equal(1, scope.Count);
+                Assert.Equal(501, scope[0].Id);
+            }
+
+            writer.DisposeInstance(handle);
+
+            DdsInstanceState state = 0;
+            for (int i = 0; i < 20 && state != DdsInstanceState.NotAliveDisposed; i++)
+            {
+                System.Threading.Thread.Sleep(50);
+                using var scope = reader.Take();
+                for (int j = 0; j < scope.Count; j++) state = scope.Infos[j].InstanceState;
+            }
+            Assert.Equal(DdsInstanceState.NotAliveDisposed, state);
+
+            writer.UnregisterInstance(handle);
+        }
+
+        [Fact]
+        public void Write_WithUnregisteredHandle_Throws()
+        {
+            using var writer = new DdsWriter<KeyedTestMessage>(_participant, _topicName);
+
+            var sample = new KeyedTestMessage { Id = 502, Value = 1, Message = "X" };
+            Assert.Throws<ArgumentException>(() => writer.Write(sample, new DdsInstanceHandle(12345)));
+
+            var handle = writer.RegisterInstance(sample);
+            writer.UnregisterInstance(handle);
+            Assert.Throws<ArgumentException>(() => writer.Write(sample, handle));
+        }
+
+        [Fact]
+        public void Write_WithHandleOfOtherInstance_Throws()
+        {
+            using var writer = new DdsWriter<KeyedTestMessage>(_participant, _topicName);
+
+            var handle = writer.RegisterInstance(new KeyedTestMessage { Id = 503 });
+            var other = new KeyedTestMessage { Id = 504, Value = 1, Message = "Other" };
+
+            var ex = Assert.Throws<ArgumentException>(() => writer.Write(other, handle));
+            Assert.Equal("sample", ex.ParamName);
+
+            // Non-key fields do not matter
+            writer.Write(new KeyedTestMessage { Id = 503, Value = 2, Message = "Same" }, handle);
+        }
+
+        [Fact]
+        public void Dispose_LargeSample_SerializesKeyOnly()
+        {
+            string topicName = "LargePayloadKeyTopic_" + Guid.NewGuid();
+            using var writer = new DdsWriter<LargePayloadKeyMessage>(_participant, topicName);
+            using var reader = new DdsReader<LargePayloadKeyMessage, LargePayloadKeyMessage>(_participant, topicName);
+
+            var sample = new LargePayloadKeyMessage { Id = 7, Payload = new string('x', 64 * 1024) };
+
+            // 4-byte encapsulation header + 4-byte int key
+            Assert.Equal(8, writer.GetSerializedBufferSize(sample, 1));
+            Assert.True(writer.GetSerializedBufferSize(sample, 2) > 64 * 1024);
+
+            writer.Write(sample);
+            Assert.True(reader.WaitDataAsync(new System.Threading.CancellationTokenSource(2000).Token).GetAwaiter().GetResult());
+            reader.Take().Dispose();
+
+            writer.DisposeInstance(sample);
+
+            DdsInstanceState state = 0;
+            for (int i = 0; i < 20 && state != DdsInstanceState.NotAliveDisposed; i++)
+            {
+                System.Threading.Thread.Sleep(50);
+                using var scope = reader.Take();
+                for (int j = 0; j < scope.Count; j++) state = scope.Infos[j].InstanceState;
+            }
+            Assert.Equal(DdsInstanceState.NotAliveDisposed, state);
+            Assert.Equal(writer.LookupInstance(sample), reader.LookupInstance(new LargePayloadKeyMessage { Id = 7 }));
+        }
     }
 }
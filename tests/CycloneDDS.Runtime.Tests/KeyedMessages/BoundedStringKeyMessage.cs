@@ -0,0 +1,15 @@
+using CycloneDDS.Schema;
+
+namespace CycloneDDS.Runtime.Tests.KeyedMessages
+{
+    [DdsTopic("BoundedStringKeyMessage")]
+    public partial struct BoundedStringKeyMessage
+    {
+        [DdsKey]
+        [DdsManaged]
+        [MaxLength(8)]
+        public string KeyId { get; set; }
+
+        public int Value { get; set; }
+    }
+}
@@ -0,0 +1,18 @@
+using CycloneDDS.Schema;
+
+namespace CycloneDDS.Runtime.Tests.KeyedMessages
+{
+    /// <summary>
+    /// Small key with a large payload. Used to check that SDK_KEY operations
+    /// (dispose, unregister, lookup) serialize only the key.
+    /// </summary>
+    [DdsTopic("LargePayloadKeyTopic")]
+    public partial struct LargePayloadKeyMessage
+    {
+        [DdsKey, DdsId(0)]
+        public int Id;
+
+        [DdsManaged, DdsId(1)]
+        public string Payload;
+    }
+}
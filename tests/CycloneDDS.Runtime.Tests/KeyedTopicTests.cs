@@ -311,6 +311,43 @@ Assert.Equal("Updated", scope[0].Data);
             Assert.Equal(2, scope.Count);
         }
 
+        [Fact]
+        public void BoundedStringKey_KeyHashFollowsDescriptorFlag()
+        {
+            // MD5 or not is Cyclone's call (DDS_TOPIC_FIXED_KEY_XCDR2), not the generator's estimate
+            var sample = new BoundedStringKeyMessage { KeyId = "abc", Value = 1 };
+            bool useMd5 = (BoundedStringKeyMessage.GetDescriptorFlagset() & (1u << 5)) == 0;
+
+            Span<byte> expected = stackalloc byte[16];
+            Span<byte> actual = stackalloc byte[16];
+            BoundedStringKeyMessage.ComputeKeyHash(sample, expected, useMd5);
+            DdsKeySerializer<BoundedStringKeyMessage>.KeyHasher!(sample, actual);
+
+            Assert.True(expected.SequenceEqual(actual));
+        }
+
+        [Fact]
+        public void BoundedStringKey_SameKey_IsOneInstance()
+        {
+            using var participant = new DdsParticipant(domainId: 0);
+            string topicName = $"BoundedStringKeyTopic_{Guid.NewGuid()}";
+
+            using var writer = new DdsWriter<BoundedStringKeyMessage>(participant, topicName);
+            using var reader = new DdsReader<BoundedStringKeyMessage, BoundedStringKeyMessage>(participant, topicName);
+
+            writer.Write(new BoundedStringKeyMessage { KeyId = "Id_1", Value = 1 });
+            writer.Write(new BoundedStringKeyMessage { KeyId = "Id_1", Value = 2 });
+            writer.Write(new BoundedStringKeyMessage { KeyId = "Id_2", Value = 3 });
+            Thread.Sleep(100);
+
+            Assert.Equal(writer.LookupInstance(new BoundedStringKeyMessage { KeyId = "Id_1" }),
+                reader.LookupInstance(new BoundedStringKeyMessage { KeyId = "Id_1" }));
+
+            // KEEP_LAST 1: one sample per instance
+            using var scope = reader.Take();
+            Assert.Equal(2, scope.Count);
+        }
+
         [Fact]
         public void MixedKey_RoundTrip_Basic()
         {
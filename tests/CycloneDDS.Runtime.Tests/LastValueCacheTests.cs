@@ -0,0 +1,166 @@
+using System;
+using System.Threading;
+using Xunit;
+using CycloneDDS.Runtime;
+
+namespace CycloneDDS.Runtime.Tests
+{
+    [Collection("DDS Test Collection")]
+    public class LastValueCacheTests : IDisposable
+    {
+        private readonly DdsParticipant _participant;
+
+        public LastValueCacheTests()
+        {
+            _participant = new DdsParticipant(domainId: 0);
+        }
+
+        public void Dispose()
+        {
+            _participant.Dispose();
+        }
+
+        private static void PollUntil<TKey>(LastValueCache<TKey, KeyedTestMessage> cache,
+            DdsReader<KeyedTestMessage, KeyedTestMessage> reader, Func<bool> done) where TKey : notnull
+        {
+            var deadline = DateTime.UtcNow.AddSeconds(2);
+            while (!done() && DateTime.UtcNow < deadline)
+            {
+                if (cache.Poll(reader) == 0) Thread.Sleep(10);
+            }
+        }
+
+        [Fact]
+        public void GeneratedKey_KeepsLatestValuePerInstance()
+        {
+            string topicName = "Lvc_" + Guid.NewGuid();
+            using var writer = new DdsWriter<KeyedTestMessage>(_participant, topicName);
+            using var reader = new DdsReader<KeyedTestMessage, KeyedTestMessage>(_participant, topicName);
+            var cache = new LastValueCache<int, KeyedTestMessage>(capacity: 2); // forces growth
+
+            for (int n = 0; n < 5; n++)
+            {
+                for (int id = 0; id < 10; id++)
+                {
+                    writer.Write(new KeyedTestMessage { Id = id, Value = n, Message = "v" });
+                }
+            }
+
+            PollUntil(cache, reader, () => cache.Count == 10 && cache.TryGetValue(9, out var last) && last.Value == 4);
+
+            Assert.Equal(10, cache.Count);
+            for (int id = 0; id < 10; id++)
+            {
+                Assert.True(cache.TryGetValue(id, out var value, out var state));
+                Assert.Equal(4, value.Value);
+                Assert.Equal(DdsInstanceState.Alive, state);
+            }
+            Assert.False(cache.TryGetValue(42, out _));
+            Assert.Equal(10, cache.Snapshot().Count);
+        }
+
+        [Fact]
+        public void DisposedInstance_KeepsLastValueAndReportsState()
+        {
+            string topicName = "LvcDispose_" + Guid.NewGuid();
+            using var writer = new DdsWriter<KeyedTestMessage>(_participant, topicName);
+            using var reader = new DdsReader<KeyedTestMessage, KeyedTestMessage>(_participant, topicName);
+            var cache = new LastValueCache<int, KeyedTestMessage>();
+
+            var sample = new KeyedTestMessage { Id = 7, Value = 3.5, Message = "x" };
+            writer.Write(sample);
+            PollUntil(cache, reader, () => cache.Count == 1);
+
+            writer.DisposeInstance(sample);
+            PollUntil(cache, reader, () => cache.TryGetValue(7, out _, out var s) && s == DdsInstanceState.NotAliveDisposed);
+
+            Assert.True(cache.TryGetValue(7, out var value, out var state));
+            Assert.Equal(DdsInstanceState.NotAliveDisposed, state);
+            Assert.Equal(3.5, value.Value);
+        }
+
+        [Fact]
+        public void RemoveNotAlive_DropsDisposedInstancesOnly()
+        {
+            string topicName = "LvcEvict_" + Guid.NewGuid();
+            using var writer = new DdsWriter<KeyedTestMessage>(_participant, topicName);
+            using var reader = new DdsReader<KeyedTestMessage, KeyedTestMessage>(_participant, topicName);
+            var cache = new LastValueCache<int, KeyedTestMessage>();
+
+            writer.Write(new KeyedTestMessage { Id = 1, Value = 1, Message = "a" });
+            writer.Write(new KeyedTestMessage { Id = 2, Value = 2, Message = "b" });
+            PollUntil(cache, reader, () => cache.Count == 2);
+
+            writer.DisposeInstance(new KeyedTestMessage { Id = 1 });
+            PollUntil(cache, reader, () => cache.TryGetValue(1, out _, out var s) && s == DdsInstanceState.NotAliveDisposed);
+
+            Assert.Equal(1, cache.RemoveNotAlive());
+            Assert.Equal(1, cache.Count);
+            Assert.False(cache.TryGetValue(1, out _));
+            Assert.True(cache.TryGetValue(2, out _));
+
+            // Back with new data
+            writer.Write(new KeyedTestMessage { Id = 1, Value = 10, Message = "c" });
+            PollUntil(cache, reader, () => cache.Count == 2);
+            Assert.True(cache.TryGetValue(1, out var value, out var state));
+            Assert.Equal(10, value.Value);
+            Assert.Equal(DdsInstanceState.Alive, state);
+        }
+
+        [Fact]
+        public void Remove_ChurningKeys_KeepsTableBounded()
+        {
+            var cache = new LastValueCache<int, KeyedTestMessage>(capacity: 4);
+
+            cache.Update(new KeyedTestMessage { Id = -1, Value = -1 });
+            for (int id = 0; id < 10_000; id++)
+            {
+                cache.Update(new KeyedTestMessage { Id = id, Value = id });
+                Assert.True(cache.Remove(id));
+                Assert.False(cache.Remove(id));
+            }
+
+            Assert.Equal(1, cache.Count);
+            Assert.True(cache.TryGetValue(-1, out var kept));
+            Assert.Equal(-1, kept.Value);
+            Assert.Single(cache.Snapshot());
+        }
+
+        [Fact]
+        public void ConcurrentReaders_NeverSeeTornValues()
+        {
+            var cache = new LastValueCache<int, Pair>(capacity: 4, keySelector: p => p.Key);
+            using var stop = new CancellationTokenSource();
+            int torn = 0;
+
+            var readers = new Thread[2];
+            for (int t = 0; t < readers.Length; t++)
+            {
+                readers[t] = new Thread(() =>
+                {
+                    while (!stop.IsCancellationRequested)
+                    {
+                        if (cache.TryGetValue(1, out var p) && p.A != p.B) Interlocked.Increment(ref torn);
+                    }
+                });
+                readers[t].Start();
+            }
+
+            for (long n = 0; n < 200_000; n++)
+            {
+                cache.Update(new Pair { Key = 1, A = n, B = n });
+            }
+            stop.Cancel();
+            foreach (var thread in readers) thread.Join();
+
+            Assert.Equal(0, torn);
+        }
+
+        private struct Pair
+        {
+            public int Key;
+            public long A;
+            public long B;
+        }
+    }
+}
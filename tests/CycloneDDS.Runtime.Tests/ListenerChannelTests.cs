@@ -0,0 +1,145 @@
+using System;
+using System.Collections.Generic;
+using System.Threading;
+using System.Threading.Channels;
+using System.Threading.Tasks;
+using Xunit;
+using CycloneDDS.Runtime;
+using CycloneDDS.Runtime.Interop;
+
+namespace CycloneDDS.Runtime.Tests
+{
+    [Collection("DDS Test Collection")]
+    public class ListenerChannelTests : IDisposable
+    {
+        private readonly DdsParticipant _participant;
+
+        public ListenerChannelTests()
+        {
+            _participant = new DdsParticipant(domainId: 0);
+        }
+
+        public void Dispose()
+        {
+            _participant.Dispose();
+        }
+
+        private DdsReader<KeyedTestMessage, KeyedTestMessage> CreateKeepAllReader(string topicName)
+        {
+            var qos = DdsApi.dds_create_qos();
+            DdsApi.dds_qset_history(qos, DdsApi.DDS_HISTORY_KEEP_ALL, 0);
+            var reader = new DdsReader<KeyedTestMessage, KeyedTestMessage>(_participant, topicName, qos);
+            DdsApi.dds_delete_qos(qos);
+            return reader;
+        }
+
+        [Fact]
+        public async Task OpenChannel_DeliversDecodedSamples_AndCompletesOnDispose()
+        {
+            string topicName = "Channel_" + Guid.NewGuid();
+            using var writer = new DdsWriter<KeyedTestMessage>(_participant, topicName);
+            var reader = CreateKeepAllReader(topicName);
+
+            writer.Write(new KeyedTestMessage { Id = 7, Value = 0, Message = "early" }); // before the channel exists
+            Thread.Sleep(100);
+
+            var channel = reader.OpenChannel(capacity: 64);
+            Assert.Throws<InvalidOperationException>(() => reader.OpenChannel());
+
+            for (int i = 1; i < 5; i++)
+            {
+                writer.Write(new KeyedTestMessage { Id = 7, Value = i, Message = "m" + i });
+            }
+
+            using var cts = new CancellationTokenSource(5000);
+            var received = new List<KeyedTestMessage>();
+            await foreach (var sample in channel.ReadAllAsync(cts.Token))
+            {
+                received.Add(sample);
+                if (received.Count == 5) break;
+            }
+
+            Assert.Equal("early", received[0].Message);
+            for (int i = 1; i < 5; i++)
+            {
+                Assert.Equal(i, received[i].Value);
+                Assert.Equal("m" + i, received[i].Message);
+            }
+
+            reader.Dispose();
+            await channel.Completion.WaitAsync(TimeSpan.FromSeconds(2));
+        }
+
+        [Fact]
+        public async Task ListenerFillFailure_FaultsChannel_AndIsRecorded()
+        {
+            string topicName = "Channel_" + Guid.NewGuid();
+            using var writer = new DdsWriter<KeyedTestMessage>(_participant, topicName);
+            using var reader = CreateKeepAllReader(topicName);
+
+            var channel = reader.OpenChannel(capacity: 16);
+            reader.SetFilter(_ => throw new InvalidOperationException("filter"));
+
+            writer.Write(new KeyedTestMessage { Id = 1, Value = 1, Message = "x" });
+
+            var ex = await Assert.ThrowsAsync<InvalidOperationException>(
+                () => channel.Completion.WaitAsync(TimeSpan.FromSeconds(5)));
+            Assert.Equal("filter", ex.Message);
+            Assert.Same(ex, reader.LastHandlerError);
+        }
+
+        [Fact]
+        public async Task WaitMode_KeepsOverflowInReaderCache_UntilDrained()
+        {
+            string topicName = "Channel_" + Guid.NewGuid();
+            using var writer = new DdsWriter<KeyedTestMessage>(_participant, topicName);
+            using var reader = CreateKeepAllReader(topicName);
+            var channel = reader.OpenChannel(capacity: 2, fullMode: BoundedChannelFullMode.Wait);
+
+            const int total = 20;
+            for (int i = 0; i < total; i++)
+            {
+                writer.Write(new KeyedTestMessage { Id = 1, Value = i, Message = "w" });
+            }
+
+            var deadline = DateTime.UtcNow.AddSeconds(2);
+            while (channel.Count < 2 && DateTime.UtcNow < deadline) Thread.Sleep(10);
+            Assert.Equal(2, channel.Count);
+
+            using var cts = new CancellationTokenSource(5000);
+            var values = new List<double>();
+            await foreach (var sample in channel.ReadAllAsync(cts.Token))
+            {
+                values.Add(sample.Value);
+                if (values.Count == total) break;
+            }
+
+            for (int i = 0; i < total; i++) Assert.Equal(i, values[i]);
+            Assert.Equal(0, reader.ChannelDroppedCount);
+        }
+
+        [Fact]
+        public void DropOldestMode_CountsDroppedSamples()
+        {
+            string topicName = "Channel_" + Guid.NewGuid();
+            using var writer = new DdsWriter<KeyedTestMessage>(_participant, topicName);
+            using var reader = CreateKeepAllReader(topicName);
+            var channel = reader.OpenChannel(capacity: 2, fullMode: BoundedChannelFullMode.DropOldest);
+
+            const int total = 10;
+            for (int i = 0; i < total; i++)
+            {
+                writer.Write(new KeyedTestMessage { Id = 1, Value = i, Message = "d" });
+            }
+
+            var deadline = DateTime.UtcNow.AddSeconds(2);
+            while (reader.ChannelDroppedCount < total - 2 && DateTime.UtcNow < deadline) Thread.Sleep(10);
+
+            Assert.Equal(total - 2, reader.ChannelDroppedCount);
+            Assert.True(channel.TryRead(out var first));
+            Assert.True(channel.TryRead(out var second));
+            Assert.Equal(total - 2, first.Value);
+            Assert.Equal(total - 1, second.Value);
+        }
+    }
+}
@@ -0,0 +1,122 @@
+using System;
+using System.Buffers;
+using System.Threading;
+using CycloneDDS.Core;
+using Xunit;
+using CycloneDDS.Runtime;
+
+namespace CycloneDDS.Runtime.Tests
+{
+    [Collection("DDS Test Collection")]
+    public class ManagedSertypeTests : IDisposable
+    {
+        private readonly DdsParticipant _participant;
+
+        public ManagedSertypeTests()
+        {
+            _participant = new DdsParticipant(domainId: 0);
+        }
+
+        public void Dispose()
+        {
+            _participant.Dispose();
+        }
+
+        [Fact]
+        public void KeylessTopic_RoundTrip()
+        {
+            string topicName = "ManagedKeyless_" + Guid.NewGuid();
+            _participant.RegisterManagedTopic<TestMessage>(topicName);
+
+            using var writer = new DdsWriter<TestMessage>(_participant, topicName);
+            using var reader = new DdsReader<TestMessage, TestMessage>(_participant, topicName);
+
+            writer.Write(new TestMessage { Id = 1, Value = 42 });
+
+            Assert.True(reader.WaitDataAsync(new CancellationTokenSource(2000).Token).GetAwaiter().GetResult());
+            using var scope = reader.Take();
+            Assert.Equal(1, scope.Count);
+            Assert.Equal(42, scope[0].Value);
+        }
+
+        [Fact]
+        public void KeyedTopic_InstancesSeparatedByKey()
+        {
+            string topicName = "ManagedKeyed_" + Guid.NewGuid();
+            _participant.RegisterManagedTopic<KeyedTestMessage>(topicName);
+
+            using var writer = new DdsWriter<KeyedTestMessage>(_participant, topicName);
+            using var reader = new DdsReader<KeyedTestMessage, KeyedTestMessage>(_participant, topicName);
+
+            writer.Write(new KeyedTestMessage { Id = 1, Value = 1, Message = "a" });
+            writer.Write(new KeyedTestMessage { Id = 2, Value = 2, Message = "b" });
+            writer.Write(new KeyedTestMessage { Id = 1, Value = 3, Message = "c" });
+
+            var h1 = writer.LookupInstance(new KeyedTestMessage { Id = 1 });
+            var h2 = writer.LookupInstance(new KeyedTestMessage { Id = 2 });
+            Assert.False(h1.IsNil);
+            Assert.False(h2.IsNil);
+            Assert.NotEqual(h1, h2);
+
+            Assert.True(reader.WaitDataAsync(new CancellationTokenSource(2000).Token).GetAwaiter().GetResult());
+            Thread.Sleep(100);
+            using var scope = reader.Take();
+            Assert.Equal(3, scope.Count);
+        }
+
+        [Fact]
+        public void KeyedTopic_DisposeReachesReader()
+        {
+            string topicName = "ManagedDispose_" + Guid.NewGuid();
+            _participant.RegisterManagedTopic<KeyedTestMessage>(topicName);
+
+            using var writer = new DdsWriter<KeyedTestMessage>(_participant, topicName);
+            using var reader = new DdsReader<KeyedTestMessage, KeyedTestMessage>(_participant, topicName);
+
+            var sample = new KeyedTestMessage { Id = 9, Value = 1, Message = "x" };
+            writer.Write(sample);
+            Assert.True(reader.WaitDataAsync(new CancellationTokenSource(2000).Token).GetAwaiter().GetResult());
+            reader.Take().Dispose();
+
+            writer.DisposeInstance(sample);
+
+            DdsInstanceState state = 0;
+            for (int i = 0; i < 20 && state != DdsInstanceState.NotAliveDisposed; i++)
+            {
+                Thread.Sleep(50);
+                using var scope = reader.Take();
+                for (int j = 0; j < scope.Count; j++) state = scope.Infos[j].InstanceState;
+            }
+            Assert.Equal(DdsInstanceState.NotAliveDisposed, state);
+        }
+
+        [Fact]
+        public void KeyHash_FromFullSample_MatchesGeneratedHash()
+        {
+            var sample = new KeyedTestMessage { Id = 77, Value = 1.25, Message = new string('m', 500) };
+
+            // Final type: XCDR1 with the body aligned after the 4-byte header
+            var buffer = new ArrayBufferWriter<byte>();
+            var cdr = new CdrWriter(buffer, CdrEncoding.Xcdr1, origin: 4);
+            DdsWriter<KeyedTestMessage>.WriteEncapsulationHeader(ref cdr, CdrEncoding.Xcdr1);
+            sample.Serialize(ref cdr);
+            cdr.Complete();
+
+            Span<byte> expected = stackalloc byte[16];
+            Span<byte> actual = stackalloc byte[16];
+            KeyedTestMessage.ComputeKeyHash(sample, expected);
+            ManagedTypeSupport<KeyedTestMessage>.Instance.ComputeKeyHash(2, buffer.WrittenSpan, actual);
+
+            Assert.True(expected.SequenceEqual(actual));
+        }
+
+        [Fact]
+        public void RegisterManagedTopic_Twice_Throws()
+        {
+            string topicName = "ManagedTwice_" + Guid.NewGuid();
+            _participant.RegisterManagedTopic<TestMessage>(topicName);
+
+            Assert.Throws<InvalidOperationException>(() => _participant.RegisterManagedTopic<TestMessage>(topicName));
+        }
+    }
+}
@@ -0,0 +1,160 @@
+using System;
+using System.Collections.Concurrent;
+using System.Collections.Generic;
+using System.Linq;
+using System.Threading;
+using System.Threading.Tasks;
+using Xunit;
+using CycloneDDS.Runtime;
+using CycloneDDS.Runtime.Interop;
+
+namespace CycloneDDS.Runtime.Tests
+{
+    [Collection("DDS Test Collection")]
+    public class PartitionedDispatcherTests : IDisposable
+    {
+        private readonly DdsParticipant _participant;
+
+        public PartitionedDispatcherTests()
+        {
+            _participant = new DdsParticipant(domainId: 0);
+        }
+
+        public void Dispose()
+        {
+            _participant.Dispose();
+        }
+
+        [Fact]
+        public void Dispatch_KeepsPerInstanceOrder_AcrossWorkers()
+        {
+            string topicName = "Dispatch_" + Guid.NewGuid();
+            using var writer = new DdsWriter<KeyedTestMessage>(_participant, topicName);
+            var qos = DdsApi.dds_create_qos();
+            DdsApi.dds_qset_history(qos, DdsApi.DDS_HISTORY_KEEP_ALL, 0);
+            using var reader = new DdsReader<KeyedTestMessage, KeyedTestMessage>(_participant, topicName, qos);
+            DdsApi.dds_delete_qos(qos);
+
+            var seen = new ConcurrentDictionary<int, List<double>>();
+            var threads = new ConcurrentDictionary<int, ConcurrentDictionary<int, bool>>();
+            using var dispatcher = new PartitionedDispatcher<KeyedTestMessage>(sample =>
+            {
+                seen.GetOrAdd(sample.Id, _ => new List<double>()).Add(sample.Value); // one worker per key
+                threads.GetOrAdd(sample.Id, _ => new ConcurrentDictionary<int, bool>())[Environment.CurrentManagedThreadId] = true;
+                Thread.SpinWait(200);
+            }, workerCount: 4, queueCapacity: 16);
+
+            const int keys = 8, perKey = 50;
+            for (int n = 0; n < perKey; n++)
+            {
+                for (int id = 0; id < keys; id++)
+                {
+                    writer.Write(new KeyedTestMessage { Id = id, Value = n, Message = "d" });
+                }
+            }
+
+            int total = 0;
+            var deadline = DateTime.UtcNow.AddSeconds(5);
+            while (total < keys * perKey && DateTime.UtcNow < deadline)
+            {
+                int taken = dispatcher.Poll(reader, maxSamples: 64);
+                if (taken == 0) Thread.Sleep(10);
+                total += taken;
+            }
+            Assert.True(dispatcher.WaitForIdle(TimeSpan.FromSeconds(5)));
+
+            Assert.Equal(keys, seen.Count);
+            foreach (var (id, values) in seen)
+            {
+                Assert.Equal(Enumerable.Range(0, perKey).Select(v => (double)v), values);
+                Assert.Single(threads[id]);
+            }
+
+            long processed = Enumerable.Range(0, dispatcher.WorkerCount).Sum(w => dispatcher.GetWorkerStats(w).Processed);
+            Assert.Equal(keys * perKey, processed);
+        }
+
+        [Fact]
+        public void FullQueue_BlocksFeeder_UntilWorkerCatchesUp()
+        {
+            using var gate = new ManualResetEventSlim(false);
+            int handled = 0;
+            using var dispatcher = new PartitionedDispatcher<KeyedTestMessage>(_ =>
+            {
+                gate.Wait();
+                Interlocked.Increment(ref handled);
+            }, workerCount: 1, queueCapacity: 2);
+
+            var feeder = Task.Run(() =>
+            {
+                for (int i = 0; i < 10; i++)
+                {
+                    dispatcher.Post(new KeyedTestMessage { Id = 1, Value = i }, partitionKey: 1);
+                }
+            });
+
+            Assert.False(feeder.Wait(200));
+            var stats = dispatcher.GetWorkerStats(0);
+            Assert.True(stats.Stalls > 0);
+            Assert.Equal(2, stats.MaxQueueDepth);
+
+            gate.Set();
+            Assert.True(feeder.Wait(5000));
+            Assert.True(dispatcher.WaitForIdle(TimeSpan.FromSeconds(5)));
+            Assert.Equal(10, handled);
+        }
+
+        [Fact]
+        public void HandlerException_IsCounted_AndWorkerContinues()
+        {
+            using var dispatcher = new PartitionedDispatcher<KeyedTestMessage>(sample =>
+            {
+                if (sample.Value == 1) throw new InvalidOperationException("boom");
+            }, workerCount: 2);
+
+            for (int i = 0; i < 3; i++)
+            {
+                dispatcher.Post(new KeyedTestMessage { Id = 5, Value = i }, partitionKey: 5);
+            }
+            Assert.True(dispatcher.WaitForIdle(TimeSpan.FromSeconds(5)));
+
+            var stats = Enumerable.Range(0, 2).Select(dispatcher.GetWorkerStats).ToList();
+            Assert.Equal(3, stats.Sum(s => s.Processed));
+            Assert.Equal(1, stats.Sum(s => s.Failed));
+            Assert.IsType<InvalidOperationException>(dispatcher.LastError);
+        }
+
+        [Fact]
+        public void Dispose_WhilePosting_ProcessesEveryAcceptedSample()
+        {
+            long handled = 0;
+            var dispatcher = new PartitionedDispatcher<KeyedTestMessage>(
+                _ => Interlocked.Increment(ref handled), workerCount: 2, queueCapacity: 16);
+
+            long accepted = 0;
+            var feeder = Task.Run(() =>
+            {
+                for (int i = 0; ; i++)
+                {
+                    try
+                    {
+                        dispatcher.Post(new KeyedTestMessage { Id = i, Value = i }, partitionKey: i);
+                    }
+                    catch (ObjectDisposedException)
+                    {
+                        return;
+                    }
+                    accepted++;
+                }
+            });
+
+            Thread.Sleep(50);
+            dispatcher.Dispose();
+
+            Assert.True(feeder.Wait(TimeSpan.FromSeconds(5)));
+            Assert.Null(feeder.Exception);
+            Assert.Equal(accepted, Interlocked.Read(ref handled));
+            Assert.True(dispatcher.WaitForIdle(TimeSpan.Zero));
+        }
+    }
+}
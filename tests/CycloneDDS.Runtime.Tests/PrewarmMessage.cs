@@ -0,0 +1,22 @@
+using CycloneDDS.Schema;
+
+namespace CycloneDDS.Runtime.Tests
+{
+    // Used only by PrewarmTests so no other test initializes its writer first.
+    [DdsTopic("PrewarmTopic")]
+    public partial struct PrewarmMessage
+    {
+        public int Id;
+        public double Value;
+        [DdsManaged] public string Label;
+    }
+
+    // Used only by the first-write timing test, so its first write is not warmed by another test.
+    [DdsTopic("PrewarmTimingTopic")]
+    public partial struct PrewarmTimingMessage
+    {
+        public int Id;
+        public double Value;
+        [DdsManaged] public string Label;
+    }
+}
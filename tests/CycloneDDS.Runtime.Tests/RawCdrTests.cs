@@ -0,0 +1,119 @@
+using System;
+using System.Threading;
+using Xunit;
+using CycloneDDS.Runtime;
+
+namespace CycloneDDS.Runtime.Tests
+{
+    [Collection("DDS Test Collection")]
+    public class RawCdrTests : IDisposable
+    {
+        private readonly DdsParticipant _participant;
+
+        public RawCdrTests()
+        {
+            _participant = new DdsParticipant(domainId: 0);
+        }
+
+        public void Dispose()
+        {
+            _participant.Dispose();
+        }
+
+        private static void WaitFor(Func<bool> condition)
+        {
+            for (int i = 0; i < 40 && !condition(); i++) Thread.Sleep(50);
+        }
+
+        [Fact]
+        public void RawReader_To_WriteRaw_ForwardsSample()
+        {
+            string source = "RawSource_" + Guid.NewGuid();
+            string target = "RawTarget_" + Guid.NewGuid();
+
+            using var sourceWriter = new DdsWriter<KeyedTestMessage>(_participant, source);
+            using var rawReader = new DdsRawReader(_participant, source, typeof(KeyedTestMessage));
+            using var targetWriter = new DdsWriter<KeyedTestMessage>(_participant, target);
+            using var targetReader = new DdsReader<KeyedTestMessage, KeyedTestMessage>(_participant, target);
+
+            sourceWriter.Write(new KeyedTestMessage { Id = 3, Value = 2.5, Message = "relay" });
+
+            int forwarded = 0;
+            WaitFor(() =>
+            {
+                using var scope = rawReader.Take();
+                for (int i = 0; i < scope.Count; i++)
+                {
+                    var cdr = scope.GetCdr(i);
+                    if (cdr.IsEmpty) continue;
+                    targetWriter.WriteRaw(cdr);
+                    forwarded++;
+                }
+                return forwarded > 0;
+            });
+            Assert.Equal(1, forwarded);
+
+            Assert.True(targetReader.WaitDataAsync(new CancellationTokenSource(2000).Token).GetAwaiter().GetResult());
+            using var received = targetReader.Take();
+            Assert.Equal(1, received.Count);
+            Assert.Equal(3, received[0].Id);
+            Assert.Equal(2.5, received[0].Value);
+            Assert.Equal("relay", received[0].Message);
+        }
+
+        [Fact]
+        public void RawScope_CopyTo_MatchesGetCdr_AndChecksLength()
+        {
+            string topic = "RawCopy_" + Guid.NewGuid();
+
+            using var writer = new DdsWriter<TestMessage>(_participant, topic);
+            using var rawReader = new DdsRawReader(_participant, topic, typeof(TestMessage));
+
+            writer.Write(new TestMessage { Id = 1, Value = 7 });
+
+            bool checkedSample = false;
+            WaitFor(() =>
+            {
+                using var scope = rawReader.Read();
+                if (scope.Count == 0) return false;
+
+                int size = scope.GetSize(0);
+                var copy = new byte[size];
+                Assert.Equal(size, scope.CopyTo(0, copy));
+                Assert.True(scope.GetCdr(0).SequenceEqual(copy));
+
+                var tooSmall = new byte[size - 1];
+                bool threw = false;
+                try { scope.CopyTo(0, tooSmall); } catch (ArgumentException) { threw = true; }
+                Assert.True(threw);
+
+                // Zero managed allocations on the access path
+                Span<byte> buffer = stackalloc byte[size];
+                long before = GC.GetAllocatedBytesForCurrentThread();
+                for (int i = 0; i < 100; i++)
+                {
+                    scope.GetCdr(0);
+                    scope.CopyTo(0, buffer);
+                }
+                Assert.Equal(0, GC.GetAllocatedBytesForCurrentThread() - before);
+
+                checkedSample = true;
+                return true;
+            });
+            Assert.True(checkedSample);
+        }
+
+        [Fact]
+        public void WriteRaw_TooShort_Throws()
+        {
+            using var writer = new DdsWriter<TestMessage>(_participant, "RawShort_" + Guid.NewGuid());
+            Assert.Throws<ArgumentException>(() => writer.WriteRaw(new byte[2]));
+        }
+
+        [Fact]
+        public void RawReader_NonStructType_Throws()
+        {
+            Assert.Throws<ArgumentException>(() => new DdsRawReader(_participant, "RawBad", typeof(string)));
+        }
+    }
+}
@@ -0,0 +1,96 @@
+using System;
+using System.Collections.Generic;
+using System.Threading;
+using System.Threading.Tasks;
+using Xunit;
+using CycloneDDS.Runtime;
+
+namespace CycloneDDS.Runtime.Tests
+{
+    [Collection("DDS Test Collection")]
+    public class RetainedSampleTests : IDisposable
+    {
+        private readonly DdsParticipant _participant;
+
+        public RetainedSampleTests()
+        {
+            _participant = new DdsParticipant(domainId: 0);
+        }
+
+        public void Dispose()
+        {
+            _participant.Dispose();
+        }
+
+        [Fact]
+        public void Retain_OutlivesScope_AndDecodesOnAnotherThread()
+        {
+            string topicName = "Retain_" + Guid.NewGuid();
+            using var writer = new DdsWriter<KeyedTestMessage>(_participant, topicName);
+            using var reader = new DdsReader<KeyedTestMessage, KeyedTestMessage>(_participant, topicName);
+
+            writer.Write(new KeyedTestMessage { Id = 1, Value = 1.5, Message = "first" });
+            writer.Write(new KeyedTestMessage { Id = 2, Value = 2.5, Message = "second" });
+            Assert.True(reader.WaitDataAsync(new CancellationTokenSource(2000).Token).GetAwaiter().GetResult());
+
+            var retained = new List<RetainedSample<KeyedTestMessage>>();
+            byte[]? raw;
+            using (var scope = reader.Take())
+            {
+                Assert.Equal(2, scope.Count);
+                for (int i = 0; i < scope.Count; i++) retained.Add(scope.Retain(i));
+                raw = scope.GetRawCdrBytes(0);
+            }
+
+            // Decoded after the scope released its references
+            var decoded = Task.Run(() => retained.ConvertAll(r => r.Decode())).GetAwaiter().GetResult();
+            Assert.Contains(decoded, s => s.Id == 1 && s.Value == 1.5 && s.Message == "first");
+            Assert.Contains(decoded, s => s.Id == 2 && s.Value == 2.5 && s.Message == "second");
+            Assert.All(retained, r => Assert.True(r.HasData));
+
+            var copy = new byte[retained[0].Size];
+            Assert.Equal(copy.Length, retained[0].CopyTo(copy));
+            Assert.Equal(raw, copy);
+            Assert.Throws<ArgumentException>(() => retained[0].CopyTo(new byte[2]));
+
+            foreach (var r in retained)
+            {
+                r.Dispose();
+                r.Dispose(); // idempotent
+                Assert.Throws<ObjectDisposedException>(() => r.Decode());
+            }
+        }
+
+        [Fact]
+        public void Retain_DisposeNotification_HasNoData()
+        {
+            string topicName = "Retain_" + Guid.NewGuid();
+            using var writer = new DdsWriter<KeyedTestMessage>(_participant, topicName);
+            using var reader = new DdsReader<KeyedTestMessage, KeyedTestMessage>(_participant, topicName);
+
+            var sample = new KeyedTestMessage { Id = 3, Value = 3, Message = "gone" };
+            writer.Write(sample);
+            Assert.True(reader.WaitDataAsync(new CancellationTokenSource(2000).Token).GetAwaiter().GetResult());
+            using (reader.Take()) { }
+
+            writer.DisposeInstance(sample);
+
+            RetainedSample<KeyedTestMessage>? notification = null;
+            var deadline = DateTime.UtcNow.AddSeconds(2);
+            while (notification == null && DateTime.UtcNow < deadline)
+            {
+                using var scope = reader.Take();
+                if (scope.Count > 0) notification = scope.Retain(0);
+                else Thread.Sleep(10);
+            }
+
+            Assert.NotNull(notification);
+            using (notification)
+            {
+                Assert.False(notification!.HasData);
+                Assert.Equal(DdsInstanceState.NotAliveDisposed, notification.Info.InstanceState);
+                Assert.Equal(0, notification.Decode().Id);
+            }
+        }
+    }
+}
@@ -0,0 +1,91 @@
+using System;
+using System.Collections.Generic;
+using System.Threading;
+using System.Threading.Tasks;
+using Xunit;
+using CycloneDDS.Runtime;
+
+namespace CycloneDDS.Runtime.Tests
+{
+    [Collection("DDS Test Collection")]
+    public class SampleBatchTests : IDisposable
+    {
+        private readonly DdsParticipant _participant;
+
+        public SampleBatchTests()
+        {
+            _participant = new DdsParticipant(domainId: 0);
+        }
+
+        public void Dispose()
+        {
+            _participant.Dispose();
+        }
+
+        [Fact]
+        public async Task TakeBatch_SurvivesAwait_AndThrowsAfterDispose()
+        {
+            string topicName = "Batch_" + Guid.NewGuid();
+            using var writer = new DdsWriter<KeyedTestMessage>(_participant, topicName);
+            using var reader = new DdsReader<KeyedTestMessage, KeyedTestMessage>(_participant, topicName);
+
+            writer.Write(new KeyedTestMessage { Id = 1, Value = 1.5, Message = "first" });
+            writer.Write(new KeyedTestMessage { Id = 2, Value = 2.5, Message = "second" });
+            Assert.True(await reader.WaitDataAsync(new CancellationTokenSource(2000).Token));
+
+            var batch = reader.TakeBatch();
+            await Task.Yield();
+            await Task.Run(() => { }); // resume on another thread
+
+            Assert.Equal(2, batch.Count);
+            var decoded = new List<KeyedTestMessage>();
+            for (int i = 0; i < batch.Count; i++)
+            {
+                Assert.True(batch.HasData(i));
+                decoded.Add(batch[i]);
+            }
+            Assert.Contains(decoded, s => s.Id == 1 && s.Value == 1.5 && s.Message == "first");
+            Assert.Contains(decoded, s => s.Id == 2 && s.Value == 2.5 && s.Message == "second");
+
+            batch.Dispose();
+            batch.Dispose(); // idempotent
+            Assert.Throws<ObjectDisposedException>(() => batch.Count);
+
+            using var empty = reader.TakeBatch();
+            Assert.Equal(0, empty.Count);
+        }
+
+        [Fact]
+        public async Task StreamBatchesAsync_YieldsWrittenSamples()
+        {
+            string topicName = "Batch_" + Guid.NewGuid();
+            using var writer = new DdsWriter<KeyedTestMessage>(_participant, topicName);
+            using var reader = new DdsReader<KeyedTestMessage, KeyedTestMessage>(_participant, topicName);
+            using var cts = new CancellationTokenSource(5000);
+
+            const int total = 10;
+            var received = new HashSet<int>();
+            var consumer = Task.Run(async () =>
+            {
+                await foreach (var batch in reader.StreamBatchesAsync(maxSamples: 4, cts.Token))
+                {
+                    using (batch)
+                    {
+                        Assert.InRange(batch.Count, 1, 4);
+                        for (int i = 0; i < batch.Count; i++) received.Add(batch[i].Id);
+                    }
+                    if (received.Count == total) break;
+                }
+            });
+
+            await Task.Delay(100);
+            for (int i = 0; i < total; i++)
+            {
+                writer.Write(new KeyedTestMessage { Id = i, Value = i, Message = "s" });
+            }
+
+            await consumer;
+            Assert.Equal(total, received.Count);
+        }
+    }
+}
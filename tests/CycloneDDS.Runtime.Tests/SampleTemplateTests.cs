@@ -0,0 +1,79 @@
+using System;
+using System.Threading;
+using Xunit;
+using CycloneDDS.Runtime;
+
+namespace CycloneDDS.Runtime.Tests
+{
+    [Collection("DDS Test Collection")]
+    public class SampleTemplateTests : IDisposable
+    {
+        private readonly DdsParticipant _participant;
+
+        public SampleTemplateTests()
+        {
+            _participant = new DdsParticipant(domainId: 0);
+        }
+
+        public void Dispose()
+        {
+            _participant.Dispose();
+        }
+
+        [Fact]
+        public void Template_PatchedFields_ReachReader()
+        {
+            string topicName = "Template_" + Guid.NewGuid();
+            using var writer = new DdsWriter<KeyedTestMessage>(_participant, topicName);
+            using var reader = new DdsReader<KeyedTestMessage, KeyedTestMessage>(_participant, topicName);
+
+            using var template = writer.CreateTemplate(new KeyedTestMessage { Id = 4, Value = 0, Message = "status" });
+            var value = template.Field(x => x.Value);
+
+            for (int i = 1; i <= 3; i++)
+            {
+                template.Set(value, i * 1.5);
+                writer.Write(template);
+            }
+
+            Assert.True(reader.WaitDataAsync(new CancellationTokenSource(2000).Token).GetAwaiter().GetResult());
+            Thread.Sleep(100);
+            using var scope = reader.Take();
+            Assert.True(scope.Count >= 1);
+
+            var last = scope[scope.Count - 1];
+            Assert.Equal(4, last.Id);
+            Assert.Equal(4.5, last.Value);
+            Assert.Equal("status", last.Message);
+        }
+
+        [Fact]
+        public void Template_SetByExpression_AppendableType()
+        {
+            string topicName = "TemplateAppendable_" + Guid.NewGuid();
+            using var writer = new DdsWriter<TestMessage>(_participant, topicName);
+            using var reader = new DdsReader<TestMessage, TestMessage>(_participant, topicName);
+
+            using var template = writer.CreateTemplate(new TestMessage { Id = 1, Value = 1 });
+            template.Set(x => x.Value, 77);
+            writer.Write(template);
+
+            Assert.True(reader.WaitDataAsync(new CancellationTokenSource(2000).Token).GetAwaiter().GetResult());
+            using var scope = reader.Take();
+            Assert.Equal(1, scope.Count);
+            Assert.Equal(1, scope[0].Id);
+            Assert.Equal(77, scope[0].Value);
+        }
+
+        [Fact]
+        public void Template_KeyOrWrongSize_Throws()
+        {
+            using var writer = new DdsWriter<KeyedTestMessage>(_participant, "TemplateInvalid_" + Guid.NewGuid());
+            using var template = writer.CreateTemplate(new KeyedTestMessage { Id = 1, Message = "m" });
+
+            // Key members select the instance and are not patchable
+            Assert.Throws<ArgumentException>(() => template.Field(x => x.Id));
+            Assert.Throws<ArgumentException>(() => template.Field<float>("Value"));
+        }
+    }
+}
@@ -0,0 +1,119 @@
+using System;
+using System.Threading;
+using Xunit;
+using CycloneDDS.Runtime;
+
+namespace CycloneDDS.Runtime.Tests
+{
+    [Collection("DDS Test Collection")]
+    public class SerializedSampleTests : IDisposable
+    {
+        private readonly DdsParticipant _participant;
+
+        public SerializedSampleTests()
+        {
+            _participant = new DdsParticipant(domainId: 0);
+        }
+
+        public void Dispose()
+        {
+            _participant.Dispose();
+        }
+
+        private static KeyedTestMessage TakeOne(DdsReader<KeyedTestMessage, KeyedTestMessage> reader)
+        {
+            Assert.True(reader.WaitDataAsync(new CancellationTokenSource(2000).Token).GetAwaiter().GetResult());
+            using var scope = reader.Take();
+            Assert.Equal(1, scope.Count);
+            return scope[0];
+        }
+
+        [Fact]
+        public void Serialize_Once_WriteToSeveralTopics()
+        {
+            string topicA = "SerializedA_" + Guid.NewGuid();
+            string topicB = "SerializedB_" + Guid.NewGuid();
+
+            using var writerA = new DdsWriter<KeyedTestMessage>(_participant, topicA);
+            using var writerB = new DdsWriter<KeyedTestMessage>(_participant, topicB);
+            using var readerA = new DdsReader<KeyedTestMessage, KeyedTestMessage>(_participant, topicA);
+            using var readerB = new DdsReader<KeyedTestMessage, KeyedTestMessage>(_participant, topicB);
+
+            using (var sample = writerA.Serialize(new KeyedTestMessage { Id = 5, Value = 1.5, Message = "shared" }))
+            {
+                Assert.True(sample.Size > 4);
+                writerA.Write(sample);
+                writerB.Write(sample);
+            }
+
+            var a = TakeOne(readerA);
+            var b = TakeOne(readerB);
+            Assert.Equal(5, a.Id);
+            Assert.Equal("shared", a.Message);
+            Assert.Equal(5, b.Id);
+            Assert.Equal(1.5, b.Value);
+            Assert.Equal("shared", b.Message);
+        }
+
+        [Fact]
+        public void LaterWrites_DoNotRestampEarlierOnes()
+        {
+            string topicA = "SerializedA_" + Guid.NewGuid();
+            string topicB = "SerializedB_" + Guid.NewGuid();
+
+            using var writerA = new DdsWriter<KeyedTestMessage>(_participant, topicA);
+            using var writerB = new DdsWriter<KeyedTestMessage>(_participant, topicB);
+            using var readerA = new DdsReader<KeyedTestMessage, KeyedTestMessage>(_participant, topicA);
+            using var readerB = new DdsReader<KeyedTestMessage, KeyedTestMessage>(_participant, topicB);
+
+            using var sample = writerA.Serialize(new KeyedTestMessage { Id = 6, Value = 2, Message = "stamped" });
+            writerA.Write(sample);
+            Assert.True(readerA.WaitDataAsync(new CancellationTokenSource(2000).Token).GetAwaiter().GetResult());
+
+            Thread.Sleep(20);
+            writerB.Write(sample);
+            Assert.True(readerB.WaitDataAsync(new CancellationTokenSource(2000).Token).GetAwaiter().GetResult());
+
+            if (!DdsWriter<KeyedTestMessage>.StampsSharedSamples) return; // unpatched ddsc: dds_writecdr re-stamps
+
+            using var scopeA = readerA.Read();
+            using var scopeB = readerB.Read();
+            Assert.Equal(sample.SourceTimestamp, scopeA.Infos[0].SourceTimestamp);
+            Assert.Equal(sample.SourceTimestamp, scopeB.Infos[0].SourceTimestamp);
+        }
+
+        [Fact]
+        public void Write_DifferentSertype_ConvertsOnce()
+        {
+            // A managed-sertype topic does not share the descriptor-based sertype
+            string plainTopic = "SerializedPlain_" + Guid.NewGuid();
+            string managedTopic = "SerializedManaged_" + Guid.NewGuid();
+            _participant.RegisterManagedTopic<KeyedTestMessage>(managedTopic);
+
+            using var plainWriter = new DdsWriter<KeyedTestMessage>(_participant, plainTopic);
+            using var managedWriter = new DdsWriter<KeyedTestMessage>(_participant, managedTopic);
+            using var managedReader = new DdsReader<KeyedTestMessage, KeyedTestMessage>(_participant, managedTopic);
+
+            using var sample = plainWriter.Serialize(new KeyedTestMessage { Id = 9, Value = 2, Message = "x" });
+            managedWriter.Write(sample);
+
+            var received = TakeOne(managedReader);
+            Assert.Equal(9, received.Id);
+            Assert.Equal("x", received.Message);
+
+            var handle = managedWriter.LookupInstance(new KeyedTestMessage { Id = 9 });
+            Assert.False(handle.IsNil);
+        }
+
+        [Fact]
+        public void Write_AfterDispose_Throws()
+        {
+            using var writer = new DdsWriter<TestMessage>(_participant, "SerializedDisposed_" + Guid.NewGuid());
+            var sample = writer.Serialize(new TestMessage { Id = 1, Value = 2 });
+            sample.Dispose();
+            sample.Dispose(); // idempotent
+
+            Assert.Throws<ObjectDisposedException>(() => writer.Write(sample));
+        }
+    }
+}
@@ -0,0 +1,79 @@
+using System;
+using System.Collections.Generic;
+using System.Threading;
+using System.Threading.Tasks;
+using Xunit;
+using CycloneDDS.Runtime;
+
+namespace CycloneDDS.Runtime.Tests
+{
+    [Collection("DDS Test Collection")]
+    public class ShardedWriterTests : IDisposable
+    {
+        private readonly DdsParticipant _participant;
+
+        public ShardedWriterTests()
+        {
+            _participant = new DdsParticipant(domainId: 0);
+        }
+
+        public void Dispose()
+        {
+            _participant.Dispose();
+        }
+
+        [Fact]
+        public void RoutesEachInstanceToOneShard()
+        {
+            string topicName = "Sharded_" + Guid.NewGuid();
+            using var writer = new ShardedWriter<KeyedTestMessage>(_participant, topicName, shardCount: 4);
+            Assert.Equal(4, writer.ShardCount);
+
+            var used = new HashSet<DdsWriter<KeyedTestMessage>>();
+            for (int id = 0; id < 64; id++)
+            {
+                var shard = writer.GetShard(new KeyedTestMessage { Id = id, Value = 1 });
+                Assert.Same(shard, writer.GetShard(new KeyedTestMessage { Id = id, Value = 2, Message = "other" }));
+                used.Add(shard);
+            }
+            // 64 small integer keys should reach every shard
+            Assert.Equal(4, used.Count);
+        }
+
+        [Fact]
+        public void ConcurrentWrites_DeliverLatestValuePerInstance()
+        {
+            string topicName = "ShardedConcurrent_" + Guid.NewGuid();
+            using var writer = new ShardedWriter<KeyedTestMessage>(_participant, topicName, shardCount: 4);
+            using var reader = new DdsReader<KeyedTestMessage, KeyedTestMessage>(_participant, topicName);
+            Assert.True(writer.WaitForReaderAsync(TimeSpan.FromSeconds(2)).GetAwaiter().GetResult());
+
+            const int Keys = 16;
+            const int Updates = 50;
+            Parallel.For(0, 4, t =>
+            {
+                for (int n = 0; n < Updates; n++)
+                {
+                    for (int id = t; id < Keys; id += 4)
+                    {
+                        writer.Write(new KeyedTestMessage { Id = id, Value = n, Message = "s" });
+                    }
+                }
+            });
+            writer.Flush();
+
+            Assert.True(reader.WaitDataAsync(new CancellationTokenSource(2000).Token).GetAwaiter().GetResult());
+            Thread.Sleep(200);
+
+            // Default reader history keeps the last sample per instance; per-instance order makes it the final update
+            var latest = new Dictionary<int, double>();
+            using (var scope = reader.Take())
+            {
+                for (int i = 0; i < scope.Count; i++) latest[scope[i].Id] = scope[i].Value;
+            }
+
+            Assert.Equal(Keys, latest.Count);
+            foreach (var value in latest.Values) Assert.Equal(Updates - 1, value);
+        }
+    }
+}
@@ -0,0 +1,97 @@
+using System;
+using System.Diagnostics;
+using System.Threading;
+using Xunit;
+using CycloneDDS.Runtime;
+
+namespace CycloneDDS.Runtime.Tests
+{
+    [Collection("DDS Test Collection")]
+    public class WriterPacingTests : IDisposable
+    {
+        private readonly DdsParticipant _participant;
+
+        public WriterPacingTests()
+        {
+            _participant = new DdsParticipant(domainId: 0);
+        }
+
+        public void Dispose()
+        {
+            _participant.Dispose();
+        }
+
+        [Fact]
+        public void SampleRate_LimitsBurst()
+        {
+            var pacing = new WriterPacing(samplesPerSecond: 100, burstWindow: TimeSpan.FromMilliseconds(50));
+
+            int admitted = 0;
+            for (int i = 0; i < 20; i++)
+            {
+                if (pacing.TryAcquire(0, out _)) admitted++;
+            }
+
+            // 50 ms window at 100/s: about 5 samples ahead of schedule
+            Assert.InRange(admitted, 5, 7);
+            Assert.False(pacing.TryAcquire(0, out var retryAfter));
+            Assert.True(retryAfter > TimeSpan.Zero);
+        }
+
+        [Fact]
+        public void ByteRate_LimitsBurstBySize()
+        {
+            // 100 ms window at 10 kB/s: about 1000 bytes ahead of schedule
+            var pacing = new WriterPacing(bytesPerSecond: 10_000, burstWindow: TimeSpan.FromMilliseconds(100));
+
+            int admitted = 0;
+            for (int i = 0; i < 10; i++)
+            {
+                if (pacing.TryAcquire(300, out _)) admitted++;
+            }
+
+            Assert.InRange(admitted, 3, 4);
+        }
+
+        [Fact]
+        public void TryWrite_And_WriteAsync_HonourPacing()
+        {
+            string topicName = "Pacing_" + Guid.NewGuid();
+            using var writer = new DdsWriter<TestMessage>(_participant, topicName);
+            using var reader = new DdsReader<TestMessage, TestMessage>(_participant, topicName);
+
+            writer.Pacing = new WriterPacing(samplesPerSecond: 20, burstWindow: TimeSpan.Zero);
+
+            Assert.True(writer.TryWrite(new TestMessage { Id = 1, Value = 1 }));
+            Assert.False(writer.TryWrite(new TestMessage { Id = 2, Value = 2 }));
+
+            var sw = Stopwatch.StartNew();
+            writer.WriteAsync(new TestMessage { Id = 3, Value = 3 }).AsTask().GetAwaiter().GetResult();
+            Assert.True(sw.ElapsedMilliseconds >= 30, $"WriteAsync returned after {sw.ElapsedMilliseconds} ms");
+
+            Assert.True(reader.WaitDataAsync(new CancellationTokenSource(2000).Token).GetAwaiter().GetResult());
+            Thread.Sleep(50);
+            using var scope = reader.Take();
+            Assert.Equal(2, scope.Count);
+        }
+
+        [Fact]
+        public void SerializedAndUnchangedWrites_AreCharged()
+        {
+            string topicName = "PacingCharge_" + Guid.NewGuid();
+            using var writer = new DdsWriter<TestMessage>(_participant, topicName);
+            writer.Pacing = new WriterPacing(samplesPerSecond: 20, burstWindow: TimeSpan.Zero);
+
+            using (var serialized = writer.Serialize(new TestMessage { Id = 1, Value = 1 }))
+            {
+                writer.Write(serialized);
+            }
+            Assert.False(writer.TryWrite(new TestMessage { Id = 2, Value = 2 }));
+
+            writer.Pacing = new WriterPacing(samplesPerSecond: 20, burstWindow: TimeSpan.Zero);
+            var sample = new TestMessage { Id = 3, Value = 3 };
+            Assert.True(writer.WriteIfChanged(sample));
+            Assert.False(writer.TryWrite(sample));
+        }
+    }
+}
@@ -37,6 +37,11 @@ namespace CycloneDDS.CodeGen
             
             EmitPartialStruct(sb, type);
             // EmitViewStruct(sb, type); // View not used for simple structs in this binding mode
+
+            if (CanEmitReadKey(type))
+            {
+                EmitKeyStruct(sb, type);
+            }
             
             if (!string.IsNullOrEmpty(type.Namespace))
             {
@@ -142,9 +147,308 @@ namespace CycloneDDS.CodeGen
             sb.AppendLine("            return this;");
             sb.AppendLine("        }");
 
+            // Counterpart of SerializeKey: reads key-only CDR (SDK_KEY serdata)
+            if (!type.HasAttribute("DdsUnion") && type.Fields.Any(f => f.HasAttribute("DdsKey")))
+            {
+                EmitDeserializeKey(sb, type);
+            }
+
+            // Key straight from full-sample CDR, for routing without a full decode
+            if (CanEmitReadKey(type))
+            {
+                EmitReadKey(sb, type);
+            }
+
+            sb.AppendLine("    }");
+        }
+
+        private void EmitDeserializeKey(StringBuilder sb, TypeInfo type)
+        {
+            sb.AppendLine();
+            sb.AppendLine($"        public static {type.Name} DeserializeKey(ref CdrReader reader)");
+            sb.AppendLine("        {");
+            sb.AppendLine("            // Key fields only, in member order, no DHEADER; other fields stay default");
+            sb.AppendLine($"            var view = new {type.Name}();");
+
+            var keyFields = type.Fields
+                .Select((f, i) => new { Field = f, Id = GetFieldId(f, i) })
+                .Where(x => x.Field.HasAttribute("DdsKey"))
+                .OrderBy(x => x.Id)
+                .Select(x => x.Field);
+
+            foreach (var field in keyFields)
+            {
+                if (IsNestedKeyedStruct(field))
+                {
+                    sb.AppendLine($"            view.{ToPascalCase(field.Name)} = {field.TypeName}.DeserializeKey(ref reader);");
+                }
+                else
+                {
+                    sb.AppendLine($"            {GetReadCall(type, field)};");
+                }
+            }
+
+            sb.AppendLine("            return view;");
+            sb.AppendLine("        }");
+        }
+
+        // ReadKey/{Type}Key need key members with value semantics: primitives, enums, strings, keyed structs
+        private bool CanEmitReadKey(TypeInfo type)
+        {
+            if (type.IsUnion || type.IsEnum || type.HasAttribute("DdsUnion")) return false;
+
+            var keyFields = type.Fields.Where(f => f.HasAttribute("DdsKey")).ToList();
+            if (keyFields.Count == 0) return false;
+
+            foreach (var field in keyFields)
+            {
+                if (IsOptional(field)) return false;
+                if (field.TypeName == "string" || IsPrimitive(field.TypeName) || IsEnumType(field.TypeName)) continue;
+                if (IsNestedKeyedStruct(field) && CanEmitReadKey(GetNestedType(field)!)) continue;
+                return false;
+            }
+            return true;
+        }
+
+        private void EmitReadKey(StringBuilder sb, TypeInfo type)
+        {
+            var fields = type.Fields
+                .Select((f, i) => new { Field = f, Id = GetFieldId(f, i) })
+                .OrderBy(x => x.Id)
+                .Select(x => x.Field)
+                .ToList();
+            int lastKey = fields.FindLastIndex(f => f.HasAttribute("DdsKey"));
+            var keyFields = fields.Where(f => f.HasAttribute("DdsKey")).ToList();
+
+            sb.AppendLine();
+            sb.AppendLine("        /// <summary>");
+            sb.AppendLine("        /// Reads the key from full-sample CDR. Members after the last key are not read, members before it");
+            sb.AppendLine("        /// are skipped by length where the encoding allows. <paramref name=\"skipToEnd\"/> leaves the reader");
+            sb.AppendLine("        /// after the whole struct (used for nested key members).");
+            sb.AppendLine("        /// </summary>");
+            sb.AppendLine($"        public static {type.Name}Key ReadKey(ref CdrReader reader, bool skipToEnd = false)");
+            sb.AppendLine("        {");
+            sb.AppendLine("            return ReadKeySample(ref reader, skipToEnd).GetKey();");
+            sb.AppendLine("        }");
+
+            sb.AppendLine();
+            sb.AppendLine("        /// <summary>");
+            sb.AppendLine("        /// Like <see cref=\"ReadKey\"/>, but returns the scratch sample: key members are set, other members");
+            sb.AppendLine("        /// are unspecified. Enough for <c>ComputeKeyHash</c> and <c>SerializeKey</c>.");
+            sb.AppendLine("        /// </summary>");
+            sb.AppendLine($"        public static {type.Name} ReadKeySample(ref CdrReader reader, bool skipToEnd = false)");
+            sb.AppendLine("        {");
+            sb.AppendLine("            // Scratch for key members and for members that can only be skipped by decoding them");
+            sb.AppendLine($"            var view = new {type.Name}();");
+            sb.AppendLine("            int endPos = int.MaxValue;");
+            if (IsAppendable(type))
+            {
+                sb.AppendLine("            if (reader.Encoding == CdrEncoding.Xcdr2)");
+                sb.AppendLine("            {");
+                sb.AppendLine("                reader.Align(4);");
+                sb.AppendLine("                uint dheader = reader.ReadUInt32();");
+                sb.AppendLine("                endPos = reader.Position + (int)dheader;");
+                sb.AppendLine("            }");
+            }
+
+            for (int i = 0; i <= lastKey; i++)
+            {
+                EmitReadKeyMember(sb, type, fields[i], GetFieldId(fields[i], type.Fields.IndexOf(fields[i])));
+            }
+
+            sb.AppendLine("            if (!skipToEnd) return view;");
+            if (IsAppendable(type))
+            {
+                sb.AppendLine("            if (endPos != int.MaxValue)");
+                sb.AppendLine("            {");
+                sb.AppendLine("                reader.Seek(endPos);");
+                sb.AppendLine("                return view;");
+                sb.AppendLine("            }");
+            }
+            for (int i = lastKey + 1; i < fields.Count; i++)
+            {
+                EmitReadKeyMember(sb, type, fields[i], GetFieldId(fields[i], type.Fields.IndexOf(fields[i])));
+            }
+            sb.AppendLine("            return view;");
+            sb.AppendLine("        }");
+
+            sb.AppendLine();
+            sb.AppendLine($"        public {type.Name}Key GetKey()");
+            sb.AppendLine("        {");
+            string args = string.Join(", ", keyFields.Select(f => IsNestedKeyedStruct(f) ? $"{ToPascalCase(f.Name)}.GetKey()" : ToPascalCase(f.Name)));
+            sb.AppendLine($"            return new {type.Name}Key({args});");
+            sb.AppendLine("        }");
+        }
+
+        private void EmitReadKeyMember(StringBuilder sb, TypeInfo type, FieldInfo field, int fieldId)
+        {
+            if (IsOptional(field))
+            {
+                EmitOptionalReader(sb, type, field, fieldId);
+                return;
+            }
+
+            if (IsAppendable(type))
+            {
+                sb.AppendLine("            if (reader.Position < endPos)");
+                sb.AppendLine("            {");
+            }
+
+            if (field.HasAttribute("DdsKey"))
+            {
+                if (IsNestedKeyedStruct(field))
+                    sb.AppendLine($"                view.{ToPascalCase(field.Name)} = {field.TypeName}.ReadKeySample(ref reader, skipToEnd: true);");
+                else
+                    sb.AppendLine($"                {GetReadCall(type, field)};");
+            }
+            else
+            {
+                sb.AppendLine($"                {GetSkipCall(type, field)}");
+            }
+
+            if (IsAppendable(type))
+            {
+                sb.AppendLine("            }");
+            }
+        }
+
+        // Same alignment and layout as GetReadCall, but advances the reader instead of decoding where possible
+        private string GetSkipCall(TypeInfo type, FieldInfo field)
+        {
+            string typeName = field.TypeName;
+
+            if (typeName == "string")
+            {
+                return "reader.Align(4); reader.ReadStringBytes();";
+            }
+
+            if ((TypeMapper.IsBlittable(typeName) || TypeMapper.GetSize(typeName) == 1 || typeName == "char")
+                && TypeMapper.GetSize(typeName) > 0 && !typeName.StartsWith("System.Numerics."))
+            {
+                return $"{GetAlignCall(typeName)}reader.Seek(reader.Position + {TypeMapper.GetSize(typeName)});";
+            }
+
+            if (IsEnumType(typeName))
+            {
+                return "reader.Align(4); reader.Seek(reader.Position + 4);";
+            }
+
+            if (typeName.StartsWith("List<") || typeName.StartsWith("System.Collections.Generic.List<"))
+            {
+                string elementType = ExtractGenericType(typeName);
+                int elemSize = GetSize(elementType);
+                if (IsPrimitive(elementType) && elemSize > 0)
+                {
+                    return $"{{ reader.Align(4); int count = (int)reader.ReadUInt32(); if (count > 0) {{ reader.Align({GetAlignment(elementType)}); reader.Seek(reader.Position + count * {elemSize}); }} }}";
+                }
+            }
+
+            var nested = GetNestedType(field);
+            if (nested != null && !nested.IsEnum && !nested.IsUnion && !nested.HasAttribute("DdsUnion") && IsAppendable(nested))
+            {
+                // XCDR2 DHEADER gives the member length
+                return $"if (reader.IsXcdr2) {{ reader.Align(4); int length = (int)reader.ReadUInt32(); reader.Seek(reader.Position + length); }} else {{ {GetReadCall(type, field)}; }}";
+            }
+
+            return $"{GetReadCall(type, field)};";
+        }
+
+        private TypeInfo? GetNestedType(FieldInfo field)
+        {
+            var nested = field.Type;
+            if (nested == null && _registry != null && _registry.TryGetDefinition(field.TypeName, out var def))
+                nested = def!.TypeInfo;
+            return nested;
+        }
+
+        private bool IsEnumType(string typeName)
+        {
+            return _registry != null && _registry.TryGetDefinition(typeName, out var def) && def!.TypeInfo != null && def.TypeInfo.IsEnum;
+        }
+
+        private void EmitKeyStruct(StringBuilder sb, TypeInfo type)
+        {
+            var keyFields = type.Fields
+                .Select((f, i) => new { Field = f, Id = GetFieldId(f, i) })
+                .Where(x => x.Field.HasAttribute("DdsKey"))
+                .OrderBy(x => x.Id)
+                .Select(x => x.Field)
+                .ToList();
+            string name = $"{type.Name}Key";
+
+            string TypeOf(FieldInfo f) => IsNestedKeyedStruct(f) ? $"{f.TypeName}Key" : f.TypeName;
+
+            sb.AppendLine();
+            sb.AppendLine("    /// <summary>");
+            sb.AppendLine($"    /// Key members of <see cref=\"{type.Name}\"/>, from <see cref=\"{type.Name}.ReadKey\"/> or <see cref=\"{type.Name}.GetKey\"/>.");
+            sb.AppendLine("    /// </summary>");
+            sb.AppendLine($"    public readonly struct {name} : System.IEquatable<{name}>");
+            sb.AppendLine("    {");
+            foreach (var f in keyFields)
+            {
+                sb.AppendLine($"        public readonly {TypeOf(f)} {ToPascalCase(f.Name)};");
+            }
+            // Verbatim parameter names: a camel-cased member name may be a keyword (Class, Event, Params)
+            sb.AppendLine();
+            sb.AppendLine($"        public {name}({string.Join(", ", keyFields.Select(f => $"{TypeOf(f)} @{ToCamelCase(f.Name)}"))})");
+            sb.AppendLine("        {");
+            foreach (var f in keyFields)
+            {
+                sb.AppendLine($"            {ToPascalCase(f.Name)} = @{ToCamelCase(f.Name)};");
+            }
+            sb.AppendLine("        }");
+
+            sb.AppendLine();
+            sb.AppendLine($"        public bool Equals({name} other)");
+            sb.AppendLine("        {");
+            var compares = keyFields.Select(f =>
+            {
+                string m = ToPascalCase(f.Name);
+                if (f.TypeName == "string") return $"string.Equals({m}, other.{m}, System.StringComparison.Ordinal)";
+                if (IsEnumType(f.TypeName)) return $"{m} == other.{m}";
+                return $"{m}.Equals(other.{m})";
+            });
+            sb.AppendLine($"            return {string.Join("\n                && ", compares)};");
+            sb.AppendLine("        }");
+
+            sb.AppendLine();
+            sb.AppendLine($"        public override bool Equals(object obj) => obj is {name} other && Equals(other);");
+
+            sb.AppendLine();
+            sb.AppendLine("        public override int GetHashCode()");
+            sb.AppendLine("        {");
+            sb.AppendLine("            // FNV-1a style mix over the member hashes");
+            sb.AppendLine("            unchecked");
+            sb.AppendLine("            {");
+            sb.AppendLine("                int h = (int)2166136261;");
+            foreach (var f in keyFields)
+            {
+                string m = ToPascalCase(f.Name);
+                string hash = f.TypeName == "string" ? $"({m} != null ? {m}.GetHashCode() : 0)" : $"{m}.GetHashCode()";
+                sb.AppendLine($"                h = (h ^ {hash}) * 16777619;");
+            }
+            sb.AppendLine("                return h;");
+            sb.AppendLine("            }");
+            sb.AppendLine("        }");
+
+            sb.AppendLine();
+            sb.AppendLine($"        public static bool operator ==({name} left, {name} right) => left.Equals(right);");
+            sb.AppendLine($"        public static bool operator !=({name} left, {name} right) => !left.Equals(right);");
+
+            sb.AppendLine();
+            string display = string.Join(", ", keyFields.Select(f => $"{ToPascalCase(f.Name)}={{{ToPascalCase(f.Name)}}}"));
+            sb.AppendLine($"        public override string ToString() => $\"{name}({display})\";");
             sb.AppendLine("    }");
         }
 
+        // Mirrors SerializerEmitter: nested struct key members carry only their own key fields
+        private bool IsNestedKeyedStruct(FieldInfo field)
+        {
+            var nested = GetNestedType(field);
+            return nested != null && !nested.IsEnum && !nested.IsUnion && !nested.HasAttribute("DdsUnion")
+                && nested.Fields.Any(f => f.HasAttribute("DdsKey"));
+        }
+
         private void EmitOptionalReader(StringBuilder sb, TypeInfo type, FieldInfo field, int fieldId)
         {
             string baseType = GetBaseType(field.TypeName);
@@ -384,18 +688,7 @@ namespace CycloneDDS.CodeGen
 
         private string GetReadCall(TypeInfo type, FieldInfo field)
         {
-            int align = GetAlignment(field.TypeName);
-            string alignA = align.ToString();
-            string alignCall;
-            if (align > 4)
-            {
-                 // XCDR2 aligns 8-byte primitives to 4 bytes
-                 alignCall = $"if (reader.IsXcdr2) reader.Align(4); else reader.Align({alignA}); ";
-            }
-            else
-            {
-                 alignCall = align > 1 ? $"reader.Align({alignA}); " : "";
-            }
+            string alignCall = GetAlignCall(field.TypeName);
             
             // ToPascalCase added to all field access below
             if (field.TypeName == "string")
@@ -434,6 +727,17 @@ namespace CycloneDDS.CodeGen
             return $"view.{ToPascalCase(field.Name)} = {field.TypeName}.Deserialize(ref reader)";
         }
         
+        private string GetAlignCall(string typeName)
+        {
+            int align = GetAlignment(typeName);
+            if (align > 4)
+            {
+                 // XCDR2 aligns 8-byte primitives to 4 bytes
+                 return $"if (reader.IsXcdr2) reader.Align(4); else reader.Align({align}); ";
+            }
+            return align > 1 ? $"reader.Align({align}); " : "";
+        }
+
         private string EmitArrayReader(FieldInfo field, TypeInfo parentType)
         {
             string elementType = field.TypeName.Substring(0, field.TypeName.Length - 2);
@@ -831,6 +1135,12 @@ namespace CycloneDDS.CodeGen
             return char.ToUpper(name[0]) + name.Substring(1);
         }
 
+        private string ToCamelCase(string name)
+        {
+            if (string.IsNullOrEmpty(name)) return name;
+            return char.ToLower(name[0]) + name.Substring(1);
+        }
+
         private int GetAlignment(TypeInfo type)
         {
             // Recursive protection could be added but assuming DAG for now
@@ -8,6 +8,8 @@ namespace CycloneDDS.CodeGen
 {
     public class SerializerEmitter
     {
+        private const int KeyHashSize = 16;
+
         private GlobalTypeRegistry? _registry;
 
         public string EmitSerializer(TypeInfo type, GlobalTypeRegistry registry, bool generateUsings = true)
@@ -43,6 +45,29 @@ namespace CycloneDDS.CodeGen
             // Serialize method
             EmitSerialize(sb, type);
             
+            // Offsets of the fixed-layout prefix (SampleTemplate<T> patching)
+            if (!type.HasAttribute("DdsUnion") && !type.IsUnion)
+            {
+                EmitTryGetFieldOffset(sb, type);
+            }
+
+            // Member-wise equality matching serialized equality (WriteIfChanged, user-side diffing)
+            EmitContentEquals(sb, type);
+            
+            // Key-only methods (SDK_KEY serdata: dispose, unregister, lookup)
+            if (!type.HasAttribute("DdsUnion") && HasKeyFields(type))
+            {
+                EmitGetKeySerializedSize(sb, type);
+                EmitSerializeKey(sb, type);
+
+                // XTypes key hash, only when every key member has a key hash encoding here
+                if (IsKeyHashSupported(type))
+                {
+                    EmitSerializeKeyHash(sb, type);
+                    EmitComputeKeyHash(sb, type);
+                }
+            }
+            
             // Close class
             sb.AppendLine("    }");
             
@@ -245,6 +270,377 @@ namespace CycloneDDS.CodeGen
             sb.AppendLine("        }");
         }
 
+        // Patchable members: fixed-size primitives and enums, written little-endian at a data-independent offset
+        private bool IsPatchableField(FieldInfo field, out int size, out int align)
+        {
+            size = 0;
+            align = 0;
+            if (IsOptional(field)) return false;
+
+            if (IsKeyHashPrimitive(field.TypeName))
+            {
+                size = TypeMapper.GetSize(field.TypeName);
+                align = GetAlignment(field.TypeName);
+                return size > 0;
+            }
+
+            var resolved = ResolveFieldType(field);
+            if (resolved != null && resolved.IsEnum)
+            {
+                size = 4;
+                align = 4;
+                return true;
+            }
+            return false;
+        }
+
+        // Offsets (encapsulation header included) of the leading members whose position does not depend
+        // on the sample; the layout ends at the first member that is not a primitive or enum.
+        private List<(FieldInfo Field, int Offset, int Size)> GetFixedLayout(TypeInfo type, bool isXcdr2)
+        {
+            var layout = new List<(FieldInfo, int, int)>();
+            int origin = isXcdr2 ? 0 : 4;
+            int pos = 4;
+
+            if (IsAppendable(type) && isXcdr2)
+            {
+                pos += 4; // DHEADER
+            }
+
+            var fieldsWithIds = type.Fields.Select((f, i) => new { Field = f, Id = GetFieldId(f, i) }).OrderBy(x => x.Id);
+            foreach (var item in fieldsWithIds)
+            {
+                if (!IsPatchableField(item.Field, out int size, out int align)) break;
+
+                if (isXcdr2 && align > 4) align = 4;
+                pos = origin + CycloneDDS.Core.AlignmentMath.Align(pos - origin, align);
+                layout.Add((item.Field, pos, size));
+                pos += size;
+            }
+            return layout;
+        }
+
+        private void EmitTryGetFieldOffset(StringBuilder sb, TypeInfo type)
+        {
+            var xcdr1 = GetFixedLayout(type, false);
+            var xcdr2 = GetFixedLayout(type, true);
+
+            sb.AppendLine();
+            sb.AppendLine("        public static bool TryGetFieldOffset(string memberName, CdrEncoding encoding, out int offset, out int size)");
+            sb.AppendLine("        {");
+            sb.AppendLine("            // Fixed-layout prefix only; key members are not patchable (they select the instance)");
+            sb.AppendLine("            bool isXcdr2 = encoding == CdrEncoding.Xcdr2;");
+            sb.AppendLine("            switch (memberName)");
+            sb.AppendLine("            {");
+
+            for (int i = 0; i < xcdr1.Count; i++)
+            {
+                var field = xcdr1[i].Field;
+                if (field.HasAttribute("DdsKey")) continue;
+
+                sb.AppendLine($"                case \"{ToPascalCase(field.Name)}\": offset = isXcdr2 ? {xcdr2[i].Offset} : {xcdr1[i].Offset}; size = {xcdr1[i].Size}; return true;");
+            }
+
+            sb.AppendLine("                default: offset = -1; size = 0; return false;");
+            sb.AppendLine("            }");
+            sb.AppendLine("        }");
+        }
+
+        private void EmitContentEquals(StringBuilder sb, TypeInfo type)
+        {
+            sb.AppendLine();
+            sb.AppendLine($"        public bool ContentEquals(in {type.Name} other)");
+            sb.AppendLine("        {");
+            sb.AppendLine("            // Floating point compares bitwise and blittable collections by memcmp, like their CDR bytes");
+
+            var fieldsWithIds = type.Fields.Select((f, i) => new { Field = f, Id = GetFieldId(f, i) }).OrderBy(x => x.Id);
+            foreach (var item in fieldsWithIds)
+            {
+                EmitFieldEquality(sb, item.Field);
+            }
+
+            sb.AppendLine("            return true;");
+            sb.AppendLine("        }");
+        }
+
+        private void EmitFieldEquality(StringBuilder sb, FieldInfo field)
+        {
+            string name = ToPascalCase(field.Name);
+            string a = $"this.{name}";
+            string b = $"other.{name}";
+            string typeName = field.TypeName;
+
+            if (IsOptional(field))
+            {
+                string baseType = GetBaseType(typeName);
+                if (baseType == "string")
+                {
+                    sb.AppendLine($"            if (!string.Equals({a}, {b}, System.StringComparison.Ordinal)) return false; // {field.Name}");
+                }
+                else if (IsGeneratedStruct(baseType))
+                {
+                    sb.AppendLine($"            if ({a}.HasValue != {b}.HasValue || ({a}.HasValue && !{a}.Value.ContentEquals({b}.Value))) return false; // {field.Name}");
+                }
+                else
+                {
+                    sb.AppendLine($"            if ({a}.HasValue != {b}.HasValue || ({a}.HasValue && !({GetValueEquality(baseType, $"{a}.Value", $"{b}.Value")}))) return false; // {field.Name}");
+                }
+                return;
+            }
+
+            string? spanA = null, spanB = null, elementType = null;
+            if (typeName.EndsWith("[]"))
+            {
+                elementType = ExtractElementType(typeName);
+                spanA = $"new System.ReadOnlySpan<{elementType}>({a})";
+                spanB = $"new System.ReadOnlySpan<{elementType}>({b})";
+            }
+            else if (typeName.StartsWith("List<") || typeName.StartsWith("System.Collections.Generic.List<"))
+            {
+                elementType = ExtractGenericType(typeName);
+                spanA = $"System.Runtime.InteropServices.CollectionsMarshal.AsSpan({a})";
+                spanB = $"System.Runtime.InteropServices.CollectionsMarshal.AsSpan({b})";
+            }
+            else if (typeName.StartsWith("BoundedSeq") || typeName.Contains("BoundedSeq<"))
+            {
+                elementType = ExtractSequenceElementType(typeName);
+                spanA = $"{a}.AsSpan()";
+                spanB = $"{b}.AsSpan()";
+            }
+
+            if (elementType == null)
+            {
+                string equality = ResolveFieldType(field)?.IsEnum == true ? $"{a} == {b}" : GetValueEquality(typeName, a, b);
+                sb.AppendLine($"            if (!({equality})) return false; // {field.Name}");
+            }
+            else if (TypeMapper.IsBlittable(elementType))
+            {
+                sb.AppendLine($"            if (!System.MemoryExtensions.SequenceEqual(System.Runtime.InteropServices.MemoryMarshal.AsBytes({spanA}), System.Runtime.InteropServices.MemoryMarshal.AsBytes({spanB}))) return false; // {field.Name}");
+            }
+            else
+            {
+                sb.AppendLine($"            {{ // {field.Name}");
+                sb.AppendLine($"                System.ReadOnlySpan<{elementType}> left = {spanA};");
+                sb.AppendLine($"                System.ReadOnlySpan<{elementType}> right = {spanB};");
+                sb.AppendLine("                if (left.Length != right.Length) return false;");
+                sb.AppendLine("                for (int i = 0; i < left.Length; i++)");
+                sb.AppendLine("                {");
+                sb.AppendLine($"                    if (!({GetValueEquality(elementType, "left[i]", "right[i]")})) return false;");
+                sb.AppendLine("                }");
+                sb.AppendLine("            }");
+            }
+        }
+
+        private string GetValueEquality(string typeName, string a, string b)
+        {
+            string t = typeName.StartsWith("System.") ? typeName.Substring(7) : typeName;
+
+            if (typeName == "string") return $"string.Equals({a}, {b}, System.StringComparison.Ordinal)";
+            if (t is "float" or "Single") return $"System.BitConverter.SingleToInt32Bits({a}) == System.BitConverter.SingleToInt32Bits({b})";
+            if (t is "double" or "Double") return $"System.BitConverter.DoubleToInt64Bits({a}) == System.BitConverter.DoubleToInt64Bits({b})";
+            if (typeName.Contains("FixedString")) return $"System.MemoryExtensions.SequenceEqual({a}.AsUtf8Span(), {b}.AsUtf8Span())";
+            if (t == "DateTimeOffset") return $"{a}.EqualsExact({b})";
+            if (IsPrimitive(typeName) || IsEnumType(typeName)) return $"{a} == {b}";
+            if (TypeMapper.IsPrimitive(typeName)) return $"{a}.Equals({b})";
+
+            // Nested generated struct or union
+            return $"{a}.ContentEquals({b})";
+        }
+
+        private bool IsEnumType(string typeName)
+        {
+            return _registry != null && _registry.TryGetDefinition(typeName, out var def) && def!.TypeInfo != null && def.TypeInfo.IsEnum;
+        }
+
+        private bool IsGeneratedStruct(string typeName)
+        {
+            return _registry != null && _registry.TryGetDefinition(typeName, out var def) && def!.TypeInfo != null && !def.TypeInfo.IsEnum;
+        }
+
+        private bool HasKeyFields(TypeInfo type)
+        {
+            return type.Fields.Any(f => f.HasAttribute("DdsKey"));
+        }
+
+        private List<FieldInfo> GetKeyFields(TypeInfo type)
+        {
+            return type.Fields
+                .Select((f, i) => new { Field = f, Id = GetFieldId(f, i) })
+                .Where(x => x.Field.HasAttribute("DdsKey"))
+                .OrderBy(x => x.Id)
+                .Select(x => x.Field)
+                .ToList();
+        }
+
+        // Nested struct key members serialize only their own key fields (if they declare any)
+        private bool IsNestedKeyedStruct(FieldInfo field)
+        {
+            var nested = field.Type;
+            if (nested == null && _registry != null && _registry.TryGetDefinition(field.TypeName, out var def))
+                nested = def!.TypeInfo;
+            return nested != null && !nested.IsEnum && !nested.IsUnion && !nested.HasAttribute("DdsUnion") && HasKeyFields(nested);
+        }
+
+        private void EmitGetKeySerializedSize(StringBuilder sb, TypeInfo type)
+        {
+            sb.AppendLine();
+            sb.AppendLine("        public int GetKeySerializedSize(int currentOffset, CdrEncoding encoding)");
+            sb.AppendLine("        {");
+            sb.AppendLine("            var sizer = new CdrSizer(currentOffset, encoding);");
+            sb.AppendLine("            bool isXcdr2 = encoding == CdrEncoding.Xcdr2;");
+            sb.AppendLine();
+
+            bool isXcdr2 = IsAppendable(type);
+            foreach (var field in GetKeyFields(type))
+            {
+                if (IsNestedKeyedStruct(field))
+                {
+                    sb.AppendLine($"            sizer.Skip(this.{ToPascalCase(field.Name)}.GetKeySerializedSize(sizer.Position, encoding)); // {field.Name}");
+                }
+                else
+                {
+                    sb.AppendLine($"            {GetSizerCall(field, isXcdr2)}; // {field.Name}");
+                }
+            }
+
+            sb.AppendLine();
+            sb.AppendLine("            return sizer.GetSizeDelta(currentOffset);");
+            sb.AppendLine("        }");
+        }
+
+        private void EmitSerializeKey(StringBuilder sb, TypeInfo type)
+        {
+            sb.AppendLine();
+            sb.AppendLine("        public void SerializeKey(ref CdrWriter writer)");
+            sb.AppendLine("        {");
+            sb.AppendLine("            // Key fields only, in member order, no DHEADER");
+
+            bool isXcdr2 = IsAppendable(type);
+            foreach (var field in GetKeyFields(type))
+            {
+                if (IsNestedKeyedStruct(field))
+                {
+                    sb.AppendLine($"            this.{ToPascalCase(field.Name)}.SerializeKey(ref writer); // {field.Name}");
+                }
+                else
+                {
+                    sb.AppendLine($"            {GetWriterCall(field, isXcdr2)}; // {field.Name}");
+                }
+            }
+
+            sb.AppendLine("        }");
+        }
+
+        private TypeInfo? ResolveFieldType(FieldInfo field)
+        {
+            if (field.Type != null) return field.Type;
+            if (_registry != null && _registry.TryGetDefinition(field.TypeName, out var def)) return def!.TypeInfo;
+            return null;
+        }
+
+        private static bool IsKeyHashPrimitive(string typeName)
+        {
+            // Integral, floating point and bool; the remaining writer types have no IDL key equivalent
+            return TypeMapper.IsPrimitive(typeName) && TypeMapper.GetWriterMethod(typeName) switch
+            {
+                "WriteGuid" or "WriteDateTime" or "WriteDateTimeOffset" or "WriteTimeSpan" => false,
+                "WriteVector2" or "WriteVector3" or "WriteVector4" or "WriteQuaternion" or "WriteMatrix4x4" => false,
+                _ => true
+            };
+        }
+
+        private bool IsKeyHashSupported(TypeInfo type)
+        {
+            foreach (var field in GetKeyFields(type))
+            {
+                if (field.TypeName == "string" || IsKeyHashPrimitive(field.TypeName)) continue;
+
+                var nested = ResolveFieldType(field);
+                if (nested != null && nested.IsEnum) continue;
+                if (IsNestedKeyedStruct(field) && IsKeyHashSupported(nested!)) continue;
+
+                return false;
+            }
+            return true;
+        }
+
+        // Maximum size of the big-endian key stream; int.MaxValue when unbounded (strings without [MaxLength])
+        private int GetMaxKeyHashSize(TypeInfo type, int offset)
+        {
+            foreach (var field in GetKeyFields(type))
+            {
+                if (field.TypeName == "string")
+                {
+                    int maxLength = GetMaxLength(field);
+                    if (maxLength < 0) return int.MaxValue;
+
+                    // Length prefix, characters and NUL
+                    offset = CycloneDDS.Core.AlignmentMath.Align(offset, 4) + 4 + maxLength + 1;
+                    continue;
+                }
+
+                var nested = ResolveFieldType(field);
+                if (nested != null && nested.IsEnum)
+                {
+                    offset = CycloneDDS.Core.AlignmentMath.Align(offset, 4) + 4;
+                }
+                else if (IsNestedKeyedStruct(field))
+                {
+                    offset = GetMaxKeyHashSize(nested!, offset);
+                    if (offset == int.MaxValue) return int.MaxValue;
+                }
+                else
+                {
+                    int size = TypeMapper.GetSize(field.TypeName);
+                    offset = CycloneDDS.Core.AlignmentMath.Align(offset, Math.Min(size, 4)) + size;
+                }
+            }
+            return offset;
+        }
+
+        private void EmitSerializeKeyHash(StringBuilder sb, TypeInfo type)
+        {
+            sb.AppendLine();
+            sb.AppendLine("        public void SerializeKeyHash(ref KeyHashWriter writer)");
+            sb.AppendLine("        {");
+            sb.AppendLine("            // Key fields only, big-endian XCDR2");
+
+            foreach (var field in GetKeyFields(type))
+            {
+                if (IsNestedKeyedStruct(field))
+                {
+                    sb.AppendLine($"            this.{ToPascalCase(field.Name)}.SerializeKeyHash(ref writer); // {field.Name}");
+                }
+                else
+                {
+                    sb.AppendLine($"            {GetWriterCall(field, true)}; // {field.Name}");
+                }
+            }
+
+            sb.AppendLine("        }");
+        }
+
+        // The runtime binds the useMd5 overload to the descriptor's DDS_TOPIC_FIXED_KEY_XCDR2 flag, so the hash
+        // matches the one Cyclone derives for remote samples; the estimate here only serves types without one.
+        private void EmitComputeKeyHash(StringBuilder sb, TypeInfo type)
+        {
+            int maxSize = GetMaxKeyHashSize(type, 0);
+            bool useMd5 = maxSize > KeyHashSize;
+
+            sb.AppendLine();
+            sb.AppendLine($"        public static void ComputeKeyHash(in {type.Name} sample, System.Span<byte> hash16)");
+            sb.AppendLine("        {");
+            sb.AppendLine($"            ComputeKeyHash(sample, hash16, useMd5: {(useMd5 ? "true" : "false")}); // max key size {(maxSize == int.MaxValue ? "unbounded" : maxSize.ToString())}");
+            sb.AppendLine("        }");
+            sb.AppendLine();
+            sb.AppendLine($"        public static void ComputeKeyHash(in {type.Name} sample, System.Span<byte> hash16, bool useMd5)");
+            sb.AppendLine("        {");
+            sb.AppendLine($"            var writer = new KeyHashWriter(stackalloc byte[{(useMd5 ? 256 : KeyHashSize)}]);");
+            sb.AppendLine("            sample.SerializeKeyHash(ref writer);");
+            sb.AppendLine("            writer.Complete(hash16, useMd5);");
+            sb.AppendLine("        }");
+        }
+
         private void EmitUnionSerializeBody(StringBuilder sb, TypeInfo type, bool isXcdr2)
         {
             var discriminator = type.Fields.FirstOrDefault(f => f.HasAttribute("DdsDiscriminator"));